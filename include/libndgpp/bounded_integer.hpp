@@ -176,11 +176,11 @@ namespace ndgpp
                         const int base = 0,
                         char const * const delimiters = "");
 
-        bounded_integer(const bounded_integer&) noexcept;
-        bounded_integer& operator=(const bounded_integer&) noexcept;
+        constexpr bounded_integer(const bounded_integer&) noexcept = default;
+        bounded_integer& operator=(const bounded_integer&) noexcept = default;
 
-        bounded_integer(bounded_integer&&) noexcept;
-        bounded_integer& operator=( bounded_integer&&) noexcept;
+        constexpr bounded_integer(bounded_integer&&) noexcept = default;
+        bounded_integer& operator=( bounded_integer&&) noexcept = default;
 
         /// Assigns the integer to the integral value
         template <class U>
@@ -216,20 +216,6 @@ namespace ndgpp
     template <class T, T Min, T Max, class Tag>
     constexpr bounded_integer<T, Min, Max, Tag>::bounded_integer() noexcept = default;
 
-    template <class T, T Min, T Max, class Tag>
-    bounded_integer<T, Min, Max, Tag>::bounded_integer(const bounded_integer&) noexcept = default;
-
-    template <class T, T Min, T Max, class Tag>
-    bounded_integer<T, Min, Max, Tag>&
-    bounded_integer<T, Min, Max, Tag>::bounded_integer::operator=(const bounded_integer&) noexcept = default;
-
-    template <class T, T Min, T Max, class Tag>
-    bounded_integer<T, Min, Max, Tag>::bounded_integer::bounded_integer(bounded_integer&&) noexcept = default;
-
-    template <class T, T Min, T Max, class Tag>
-    bounded_integer<T, Min, Max, Tag>&
-    bounded_integer<T, Min, Max, Tag>::bounded_integer::operator=(bounded_integer&&) noexcept = default;
-
     template <class T, T Min, T Max, class Tag>
     constexpr bounded_integer<T, Min, Max, Tag>::bounded_integer(bounded_integer_min_t) noexcept:
         value_(Min)
@@ -0,0 +1,213 @@
+#ifndef LIBNDGPP_BUFFER_READER_HPP
+#define LIBNDGPP_BUFFER_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <stdexcept>
+#include <utility>
+
+#include <libndgpp/algorithm/accumulate.hpp>
+#include <libndgpp/buffer_traits.hpp>
+#include <libndgpp/error.hpp>
+
+namespace ndgpp
+{
+    /** A cursor that reads values from a contiguous buffer
+     *
+     *  Values are read with ndgpp::buffer_traits.  Each get checks
+     *  the remaining size, unless the ndgpp::unchecked overload is
+     *  used after the size of a group of values is checked once with
+     *  reserve:
+     *
+     *  \code
+     *  ndgpp::buffer_reader reader {buf, size};
+     *  reader.reserve(8);
+     *  const auto address = reader.get<ndgpp::net::ipv4_address>(ndgpp::unchecked);
+     *  const auto src_port = reader.get<ndgpp::net::port>(ndgpp::unchecked);
+     *  const auto dst_port = reader.get<ndgpp::net::port>(ndgpp::unchecked);
+     *
+     *  get_all does the same for a fixed set of values.
+     *
+     *  The buffer is not owned by the reader.
+     */
+    class buffer_reader
+    {
+        public:
+
+        /** Constructs a buffer_reader positioned at the start of a buffer
+         *
+         *  @param data The buffer to read from
+         *  @param size The size of the buffer in bytes
+         */
+        buffer_reader(uint8_t const * const data, const std::size_t size) noexcept;
+
+        /** Checks that at least size bytes can be read
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer than size bytes remain
+         */
+        void reserve(const std::size_t size) const;
+
+        /** Reads a value and advances the cursor
+         *
+         *  If the read throws, i.e. the value is out of a constrained
+         *  type's range, the cursor is not advanced.
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer bytes than the value's size remain
+         */
+        template <class T>
+        T get();
+
+        /// Reads a value and advances the cursor without checking the remaining size
+        template <class T>
+        T get(ndgpp::unchecked_t);
+
+        /** Copies a range of bytes and advances the cursor
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer than size bytes remain
+         */
+        buffer_reader & get(void * const data, const std::size_t size);
+
+        /// Copies a range of bytes and advances the cursor without checking the remaining size
+        buffer_reader & get(ndgpp::unchecked_t, void * const data, const std::size_t size) noexcept;
+
+        /** Reads each value after checking the remaining size once
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer bytes than the values' sizes remain
+         */
+        template <class ... Ts>
+        buffer_reader & get_all(Ts & ... values);
+
+        /** Returns the current position and advances the cursor by size bytes
+         *
+         *  This provides access to a range of bytes without copying them.
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer than size bytes remain
+         */
+        uint8_t const * view(const std::size_t size);
+
+        /** Advances the cursor by size bytes
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer than size bytes remain
+         */
+        buffer_reader & skip(const std::size_t size);
+
+        /// Returns the start of the buffer
+        uint8_t const * data() const noexcept;
+
+        /// Returns the current position of the cursor
+        uint8_t const * position() const noexcept;
+
+        /// Returns the size of the buffer
+        std::size_t size() const noexcept;
+
+        /// Returns the number of bytes read
+        std::size_t consumed() const noexcept;
+
+        /// Returns the number of bytes that can still be read
+        std::size_t remaining() const noexcept;
+
+        private:
+
+        uint8_t const * data_;
+        uint8_t const * position_;
+        uint8_t const * end_;
+    };
+
+    inline buffer_reader::buffer_reader(uint8_t const * const data, const std::size_t size) noexcept:
+        data_(data),
+        position_(data),
+        end_(data + size)
+    {}
+
+    inline void buffer_reader::reserve(const std::size_t size) const
+    {
+        if (size > this->remaining())
+        {
+            throw ndgpp_error(std::out_of_range, "buffer_reader size exceeded");
+        }
+    }
+
+    template <class T>
+    inline T buffer_reader::get()
+    {
+        this->reserve(std::size_t {ndgpp::buffer_traits<T>::size});
+        return this->get<T>(ndgpp::unchecked);
+    }
+
+    template <class T>
+    inline T buffer_reader::get(ndgpp::unchecked_t)
+    {
+        // The cursor is advanced after the read so a value that fails
+        // its type's constraint is not skipped
+        const T value = ndgpp::buffer_traits<T>::read(this->position_);
+        this->position_ += ndgpp::buffer_traits<T>::size;
+        return value;
+    }
+
+    inline buffer_reader & buffer_reader::get(void * const data, const std::size_t size)
+    {
+        this->reserve(size);
+        return this->get(ndgpp::unchecked, data, size);
+    }
+
+    inline buffer_reader & buffer_reader::get(ndgpp::unchecked_t, void * const data, const std::size_t size) noexcept
+    {
+        std::memcpy(data, this->position_, size);
+        this->position_ += size;
+        return *this;
+    }
+
+    template <class ... Ts>
+    inline buffer_reader & buffer_reader::get_all(Ts & ... values)
+    {
+        this->reserve(ndgpp::accumulate(std::size_t {0}, std::size_t {ndgpp::buffer_traits<Ts>::size}...));
+
+        using expander = int[];
+        static_cast<void>(expander {0, (values = this->get<Ts>(ndgpp::unchecked), 0)...});
+        return *this;
+    }
+
+    inline uint8_t const * buffer_reader::view(const std::size_t size)
+    {
+        this->reserve(size);
+        uint8_t const * const position = this->position_;
+        this->position_ += size;
+        return position;
+    }
+
+    inline buffer_reader & buffer_reader::skip(const std::size_t size)
+    {
+        this->reserve(size);
+        this->position_ += size;
+        return *this;
+    }
+
+    inline uint8_t const * buffer_reader::data() const noexcept
+    {
+        return this->data_;
+    }
+
+    inline uint8_t const * buffer_reader::position() const noexcept
+    {
+        return this->position_;
+    }
+
+    inline std::size_t buffer_reader::size() const noexcept
+    {
+        return static_cast<std::size_t>(this->end_ - this->data_);
+    }
+
+    inline std::size_t buffer_reader::consumed() const noexcept
+    {
+        return static_cast<std::size_t>(this->position_ - this->data_);
+    }
+
+    inline std::size_t buffer_reader::remaining() const noexcept
+    {
+        return static_cast<std::size_t>(this->end_ - this->position_);
+    }
+}
+
+#endif
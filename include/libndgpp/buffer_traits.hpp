@@ -0,0 +1,151 @@
+#ifndef LIBNDGPP_BUFFER_TRAITS_HPP
+#define LIBNDGPP_BUFFER_TRAITS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+
+#include <libndgpp/net/basic_ipv4_address.hpp>
+#include <libndgpp/net/port.hpp>
+#include <libndgpp/network_byte_order.hpp>
+#include <libndgpp/unaligned_network_byte_order.hpp>
+
+namespace ndgpp
+{
+    struct unchecked_t {};
+
+    /// Selects the overload of a buffer cursor operation that does not check the buffer's size
+    constexpr unchecked_t unchecked {};
+
+    /** Describes how a type is written to and read from a buffer
+     *
+     *  Specializations provide the following members:
+     *
+     *  \code
+     *  static constexpr std::size_t size;
+     *  static void write(uint8_t * const data, const T & value) noexcept;
+     *  static T read(uint8_t const * const data);
+     *
+     *  The data pointers passed to write and read are not aligned,
+     *  and refer to at least size bytes.
+     *
+     *  @tparam T The type to write and read
+     */
+    template <class T>
+    struct buffer_traits;
+
+    template <>
+    struct buffer_traits<uint8_t>
+    {
+        static constexpr std::size_t size = 1;
+
+        static void write(uint8_t * const data, const uint8_t value) noexcept
+        {
+            *data = value;
+        }
+
+        static uint8_t read(uint8_t const * const data) noexcept
+        {
+            return *data;
+        }
+    };
+
+    template <class T>
+    struct buffer_traits<ndgpp::network_byte_order<T>>
+    {
+        static constexpr std::size_t size = sizeof(T);
+
+        static void write(uint8_t * const data, const ndgpp::network_byte_order<T> value) noexcept
+        {
+            std::memcpy(data, &value, size);
+        }
+
+        static ndgpp::network_byte_order<T> read(uint8_t const * const data) noexcept
+        {
+            ndgpp::network_byte_order<T> value;
+            std::memcpy(&value, data, size);
+            return value;
+        }
+    };
+
+    template <class T>
+    struct buffer_traits<ndgpp::unaligned_network_byte_order<T>>
+    {
+        static constexpr std::size_t size = sizeof(T);
+
+        static void write(uint8_t * const data, const ndgpp::unaligned_network_byte_order<T> & value) noexcept
+        {
+            std::memcpy(data, &value, size);
+        }
+
+        static ndgpp::unaligned_network_byte_order<T> read(uint8_t const * const data) noexcept
+        {
+            ndgpp::unaligned_network_byte_order<T> value;
+            std::memcpy(&value, data, size);
+            return value;
+        }
+    };
+
+    template <std::size_t N>
+    struct buffer_traits<std::array<uint8_t, N>>
+    {
+        static constexpr std::size_t size = N;
+
+        static void write(uint8_t * const data, const std::array<uint8_t, N> & value) noexcept
+        {
+            std::memcpy(data, value.data(), size);
+        }
+
+        static std::array<uint8_t, N> read(uint8_t const * const data) noexcept
+        {
+            std::array<uint8_t, N> value;
+            std::memcpy(value.data(), data, size);
+            return value;
+        }
+    };
+
+    /// Writes and reads an IPv4 address as four octets
+    template <uint32_t Min, uint32_t Max>
+    struct buffer_traits<ndgpp::net::basic_ipv4_address<Min, Max>>
+    {
+        using address_type = ndgpp::net::basic_ipv4_address<Min, Max>;
+
+        static constexpr std::size_t size = std::tuple_size<typename address_type::value_type>::value;
+
+        static void write(uint8_t * const data, const address_type value) noexcept
+        {
+            const typename address_type::value_type octets = value.value();
+            std::memcpy(data, octets.data(), size);
+        }
+
+        /// Throws ndgpp::error<std::out_of_range> if the address is outside of [Min, Max]
+        static address_type read(uint8_t const * const data) noexcept(!address_type::constrained)
+        {
+            typename address_type::value_type octets;
+            std::memcpy(octets.data(), data, size);
+            return address_type {octets};
+        }
+    };
+
+    /// Writes and reads a port in network byte order
+    template <>
+    struct buffer_traits<ndgpp::net::port>
+    {
+        static constexpr std::size_t size = sizeof(ndgpp::net::port::value_type);
+
+        static void write(uint8_t * const data, const ndgpp::net::port value) noexcept
+        {
+            buffer_traits<ndgpp::network_byte_order<uint16_t>>::write(data, ndgpp::network_byte_order<uint16_t> {value.value()});
+        }
+
+        static ndgpp::net::port read(uint8_t const * const data) noexcept
+        {
+            const uint16_t value = buffer_traits<ndgpp::network_byte_order<uint16_t>>::read(data);
+            return ndgpp::net::port {value};
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef LIBNDGPP_BUFFER_WRITER_HPP
+#define LIBNDGPP_BUFFER_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <stdexcept>
+#include <utility>
+
+#include <libndgpp/algorithm/accumulate.hpp>
+#include <libndgpp/buffer_traits.hpp>
+#include <libndgpp/error.hpp>
+
+namespace ndgpp
+{
+    /** A cursor that writes values to a contiguous buffer
+     *
+     *  Values are written with ndgpp::buffer_traits.  Each put
+     *  checks the remaining capacity, unless the ndgpp::unchecked
+     *  overload is used after the capacity for a group of values is
+     *  checked once with reserve:
+     *
+     *  \code
+     *  ndgpp::buffer_writer writer {buf, sizeof(buf)};
+     *  writer.reserve(8);
+     *  writer.put(ndgpp::unchecked, address);
+     *  writer.put(ndgpp::unchecked, src_port);
+     *  writer.put(ndgpp::unchecked, dst_port);
+     *
+     *  put_all does the same for a fixed set of values.
+     *
+     *  The buffer is not owned by the writer.
+     */
+    class buffer_writer
+    {
+        public:
+
+        /** Constructs a buffer_writer positioned at the start of a buffer
+         *
+         *  @param data The buffer to write to
+         *  @param size The size of the buffer in bytes
+         */
+        buffer_writer(uint8_t * const data, const std::size_t size) noexcept;
+
+        /** Checks that at least size bytes can be written
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer than size bytes remain
+         */
+        void reserve(const std::size_t size) const;
+
+        /** Writes a value and advances the cursor
+         *
+         *  @throw ndgpp::error<std::out_of_range> if the value does not fit
+         */
+        template <class T>
+        buffer_writer & put(const T & value);
+
+        /// Writes a value and advances the cursor without checking the remaining capacity
+        template <class T>
+        buffer_writer & put(ndgpp::unchecked_t, const T & value) noexcept;
+
+        /** Writes a range of bytes and advances the cursor
+         *
+         *  @throw ndgpp::error<std::out_of_range> if the bytes do not fit
+         */
+        buffer_writer & put(void const * const data, const std::size_t size);
+
+        /// Writes a range of bytes and advances the cursor without checking the remaining capacity
+        buffer_writer & put(ndgpp::unchecked_t, void const * const data, const std::size_t size) noexcept;
+
+        /** Writes each value after checking the remaining capacity once
+         *
+         *  @throw ndgpp::error<std::out_of_range> if the values do not fit
+         */
+        template <class ... Ts>
+        buffer_writer & put_all(const Ts & ... values);
+
+        /** Advances the cursor by size bytes without writing to them
+         *
+         *  @throw ndgpp::error<std::out_of_range> if fewer than size bytes remain
+         */
+        buffer_writer & skip(const std::size_t size);
+
+        /// Returns the start of the buffer
+        uint8_t * data() const noexcept;
+
+        /// Returns the current position of the cursor
+        uint8_t * position() const noexcept;
+
+        /// Returns the size of the buffer
+        std::size_t size() const noexcept;
+
+        /// Returns the number of bytes written
+        std::size_t written() const noexcept;
+
+        /// Returns the number of bytes that can still be written
+        std::size_t remaining() const noexcept;
+
+        private:
+
+        uint8_t * data_;
+        uint8_t * position_;
+        uint8_t * end_;
+    };
+
+    inline buffer_writer::buffer_writer(uint8_t * const data, const std::size_t size) noexcept:
+        data_(data),
+        position_(data),
+        end_(data + size)
+    {}
+
+    inline void buffer_writer::reserve(const std::size_t size) const
+    {
+        if (size > this->remaining())
+        {
+            throw ndgpp_error(std::out_of_range, "buffer_writer capacity exceeded");
+        }
+    }
+
+    template <class T>
+    inline buffer_writer & buffer_writer::put(const T & value)
+    {
+        this->reserve(std::size_t {ndgpp::buffer_traits<T>::size});
+        return this->put(ndgpp::unchecked, value);
+    }
+
+    template <class T>
+    inline buffer_writer & buffer_writer::put(ndgpp::unchecked_t, const T & value) noexcept
+    {
+        ndgpp::buffer_traits<T>::write(this->position_, value);
+        this->position_ += ndgpp::buffer_traits<T>::size;
+        return *this;
+    }
+
+    inline buffer_writer & buffer_writer::put(void const * const data, const std::size_t size)
+    {
+        this->reserve(size);
+        return this->put(ndgpp::unchecked, data, size);
+    }
+
+    inline buffer_writer & buffer_writer::put(ndgpp::unchecked_t, void const * const data, const std::size_t size) noexcept
+    {
+        std::memcpy(this->position_, data, size);
+        this->position_ += size;
+        return *this;
+    }
+
+    template <class ... Ts>
+    inline buffer_writer & buffer_writer::put_all(const Ts & ... values)
+    {
+        this->reserve(ndgpp::accumulate(std::size_t {0}, std::size_t {ndgpp::buffer_traits<Ts>::size}...));
+
+        using expander = int[];
+        static_cast<void>(expander {0, (this->put(ndgpp::unchecked, values), 0)...});
+        return *this;
+    }
+
+    inline buffer_writer & buffer_writer::skip(const std::size_t size)
+    {
+        this->reserve(size);
+        this->position_ += size;
+        return *this;
+    }
+
+    inline uint8_t * buffer_writer::data() const noexcept
+    {
+        return this->data_;
+    }
+
+    inline uint8_t * buffer_writer::position() const noexcept
+    {
+        return this->position_;
+    }
+
+    inline std::size_t buffer_writer::size() const noexcept
+    {
+        return static_cast<std::size_t>(this->end_ - this->data_);
+    }
+
+    inline std::size_t buffer_writer::written() const noexcept
+    {
+        return static_cast<std::size_t>(this->position_ - this->data_);
+    }
+
+    inline std::size_t buffer_writer::remaining() const noexcept
+    {
+        return static_cast<std::size_t>(this->end_ - this->position_);
+    }
+}
+
+#endif
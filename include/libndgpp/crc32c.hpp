@@ -0,0 +1,42 @@
+#ifndef LIBNDGPP_CRC32C_HPP
+#define LIBNDGPP_CRC32C_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ndgpp
+{
+    /** Returns the CRC32C (Castagnoli) checksum of a buffer
+     *
+     *  The checksum of a buffer can be computed in several calls by
+     *  passing the previous result as the crc parameter:
+     *
+     *  \code
+     *  uint32_t crc = ndgpp::crc32c(header, header_size);
+     *  crc = ndgpp::crc32c(payload, payload_size, crc);
+     *
+     *  The SSE4.2 crc32 instruction is used if the processor
+     *  supports it, otherwise a table driven implementation is used.
+     *
+     *  @param data The buffer to checksum
+     *  @param size The size of the buffer in bytes
+     *  @param crc The checksum of the preceding data
+     */
+    uint32_t crc32c(void const * const data, const std::size_t size, const uint32_t crc = 0) noexcept;
+
+    /** Returns the CRC32C of two adjacent segments given the CRC32C of each segment
+     *
+     *  @param crc1 The checksum of the first segment
+     *  @param crc2 The checksum of the second segment
+     *  @param size2 The size of the second segment in bytes
+     */
+    uint32_t crc32c_combine(const uint32_t crc1, const uint32_t crc2, const std::size_t size2) noexcept;
+
+    namespace detail
+    {
+        /// The table driven implementation of ndgpp::crc32c
+        uint32_t crc32c_portable(void const * const data, const std::size_t size, const uint32_t crc) noexcept;
+    }
+}
+
+#endif
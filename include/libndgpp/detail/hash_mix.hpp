@@ -0,0 +1,26 @@
+#ifndef LIBNDGPP_DETAIL_HASH_MIX_HPP
+#define LIBNDGPP_DETAIL_HASH_MIX_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ndgpp
+{
+namespace detail
+{
+    /** Mixes the bits of an integer key for use as a hash
+     *
+     *  std::hash of an integer is the identity, which clusters keys
+     *  that differ only in a few bits, i.e. addresses from the same
+     *  subnet.  The key is multiplied by a 64 bit odd constant, the
+     *  golden ratio, which spreads each bit to the higher bits, and
+     *  the high half of the product is folded into the low half.
+     */
+    inline constexpr uint64_t hash_mix(const uint64_t key) noexcept
+    {
+        return (key * 0x9e3779b97f4a7c15ULL) ^ ((key * 0x9e3779b97f4a7c15ULL) >> 32);
+    }
+}
+}
+
+#endif
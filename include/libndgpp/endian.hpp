@@ -0,0 +1,56 @@
+#ifndef LIBNDGPP_ENDIAN_HPP
+#define LIBNDGPP_ENDIAN_HPP
+
+#include <cstdint>
+
+namespace ndgpp
+{
+    /// Identifies the byte order of a value
+    enum class endian
+    {
+        little = __ORDER_LITTLE_ENDIAN__,
+        big = __ORDER_BIG_ENDIAN__,
+        native = __BYTE_ORDER__
+    };
+
+    /// Identifies the byte order of network protocols
+    constexpr endian network_endian = endian::big;
+
+    /// @defgroup byte_swap Reverses the bytes of an unsigned integer
+    /// @{
+    inline constexpr uint8_t byte_swap(const uint8_t value) noexcept
+    {
+        return value;
+    }
+
+    inline constexpr uint16_t byte_swap(const uint16_t value) noexcept
+    {
+        return __builtin_bswap16(value);
+    }
+
+    inline constexpr uint32_t byte_swap(const uint32_t value) noexcept
+    {
+        return __builtin_bswap32(value);
+    }
+
+    inline constexpr uint64_t byte_swap(const uint64_t value) noexcept
+    {
+        return __builtin_bswap64(value);
+    }
+    /// @}
+
+    /** Converts an unsigned integer between native byte order and Order
+     *
+     *  The conversion is its own inverse, and it compiles to nothing
+     *  when Order is the native byte order.
+     *
+     *  @tparam Order The byte order to convert to or from
+     */
+    template <endian Order, class T>
+    inline constexpr T endian_convert(const T value) noexcept
+    {
+        return Order == endian::native ? value : ndgpp::byte_swap(value);
+    }
+}
+
+#endif
@@ -0,0 +1,321 @@
+#ifndef LIBNDGPP_ENDIAN_VALUE_HPP
+#define LIBNDGPP_ENDIAN_VALUE_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include <libndgpp/endian.hpp>
+
+namespace ndgpp
+{
+    namespace detail
+    {
+        template <std::size_t Size>
+        struct endian_storage;
+
+        template <>
+        struct endian_storage<1>
+        {
+            using type = uint8_t;
+        };
+
+        template <>
+        struct endian_storage<2>
+        {
+            using type = uint16_t;
+        };
+
+        template <>
+        struct endian_storage<4>
+        {
+            using type = uint32_t;
+        };
+
+        template <>
+        struct endian_storage<8>
+        {
+            using type = uint64_t;
+        };
+
+        /// Converts integral and enumeration values to and from their bits
+        template <class T, class Storage, class = void>
+        struct endian_bits
+        {
+            static constexpr Storage to_bits(const T value) noexcept
+            {
+                return static_cast<Storage>(value);
+            }
+
+            static constexpr T from_bits(const Storage bits) noexcept
+            {
+                return static_cast<T>(bits);
+            }
+        };
+
+        /// Converts floating point values to and from their bits
+        template <class T, class Storage>
+        struct endian_bits<T, Storage, std::enable_if_t<std::is_floating_point<T>::value>>
+        {
+            static Storage to_bits(const T value) noexcept
+            {
+                Storage bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+
+            static T from_bits(const Storage bits) noexcept
+            {
+                T value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+        };
+    }
+
+    /** Stores a native type value in the specified byte order
+     *
+     *  The ndgpp::endian_value class is a regular type that will
+     *  seemlessly represent a native type value in the specified
+     *  byte order.  When Order is the native byte order, conversions
+     *  to and from the native type compile to nothing.
+     *
+     *  @tparam T The native type i.e. uint32_t, int16_t, an
+     *            enumeration or double
+     *  @tparam Order The byte order of the stored value
+     */
+    template <class T, ndgpp::endian Order>
+    class endian_value
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value || std::is_floating_point<T>::value,
+                      "T is not an integral, enumeration or floating point type");
+
+        public:
+
+        using value_type = T;
+
+        /// The unsigned integer type the value is stored in
+        using storage_type = typename detail::endian_storage<sizeof(T)>::type;
+
+        /// The byte order of the stored value
+        static constexpr ndgpp::endian order = Order;
+
+        constexpr
+        endian_value() noexcept;
+
+        /** Constructs an endian_value instance with the specified value
+         *
+         *  @param value An instance of type T in host byte order
+         */
+        explicit
+        constexpr
+        endian_value(const T value) noexcept;
+
+        /// Constructs an endian_value instance from a value stored in a different byte order
+        template <ndgpp::endian OtherOrder>
+        explicit
+        constexpr
+        endian_value(const endian_value<T, OtherOrder> other) noexcept;
+
+        constexpr
+        endian_value(const endian_value & other) noexcept;
+
+        endian_value(endian_value && other) noexcept;
+
+        /** Assigns this to the value of rhs
+         *
+         *  @param rhs An instance of type T in host byte order
+         */
+        endian_value & operator= (const T rhs) noexcept;
+        endian_value & operator= (const endian_value & rhs) noexcept;
+        endian_value & operator= (endian_value && rhs) noexcept;
+
+        /// Returns the stored value in host byte order
+        constexpr
+        operator value_type () const noexcept;
+
+        /** Returns the address of the underlying value
+         *
+         *  This is useful for sending the value over a socket:
+         *
+         *  \code
+         *  const int ret = send(&v, v.size());
+         */
+        storage_type const * operator &() const noexcept;
+        storage_type * operator &() noexcept;
+
+        /// Returns the size of the underlying value
+        constexpr std::size_t size() const noexcept;
+
+        void swap(endian_value & other) noexcept;
+
+        private:
+
+        using bits_type = detail::endian_bits<T, storage_type>;
+
+        storage_type value_;
+    };
+
+    template <class T, ndgpp::endian Order>
+    constexpr ndgpp::endian endian_value<T, Order>::order;
+
+    template <class T, ndgpp::endian Order>
+    inline
+    bool operator== (const endian_value<T, Order> lhs,
+                     const endian_value<T, Order> rhs)
+    {
+        return static_cast<T>(lhs) == static_cast<T>(rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline
+    bool operator!= (const endian_value<T, Order> lhs,
+                     const endian_value<T, Order> rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline
+    bool operator< (const endian_value<T, Order> lhs,
+                    const endian_value<T, Order> rhs)
+    {
+        return static_cast<T>(lhs) < static_cast<T>(rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline
+    bool operator> (const endian_value<T, Order> lhs,
+                    const endian_value<T, Order> rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline
+    bool operator<= (const endian_value<T, Order> lhs,
+                     const endian_value<T, Order> rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline
+    bool operator>= (const endian_value<T, Order> lhs,
+                     const endian_value<T, Order> rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    void swap(endian_value<T, Order> & lhs, endian_value<T, Order> & rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline
+    std::ostream & operator <<(std::ostream & out, const endian_value<T, Order> val)
+    {
+        out << static_cast<T>(val);
+        return out;
+    }
+
+    /// Stores a native type value in big endian byte order
+    template <class T>
+    using big_endian = endian_value<T, ndgpp::endian::big>;
+
+    /// Stores a native type value in little endian byte order
+    template <class T>
+    using little_endian = endian_value<T, ndgpp::endian::little>;
+}
+
+template <class T, ndgpp::endian Order>
+inline
+constexpr
+ndgpp::endian_value<T, Order>::endian_value() noexcept = default;
+
+template <class T, ndgpp::endian Order>
+inline
+constexpr
+ndgpp::endian_value<T, Order>::endian_value(const ndgpp::endian_value<T, Order>& other) noexcept = default;
+
+template <class T, ndgpp::endian Order>
+inline
+ndgpp::endian_value<T, Order>::endian_value(ndgpp::endian_value<T, Order>&& other) noexcept = default;
+
+template <class T, ndgpp::endian Order>
+inline
+ndgpp::endian_value<T, Order> & ndgpp::endian_value<T, Order>::operator= (const ndgpp::endian_value<T, Order>& other) noexcept = default;
+
+template <class T, ndgpp::endian Order>
+inline
+ndgpp::endian_value<T, Order> & ndgpp::endian_value<T, Order>::operator= (ndgpp::endian_value<T, Order>&& other) noexcept = default;
+
+template <class T, ndgpp::endian Order>
+inline
+constexpr
+ndgpp::endian_value<T, Order>::endian_value(const T value) noexcept:
+    value_(ndgpp::endian_convert<Order>(bits_type::to_bits(value)))
+{}
+
+template <class T, ndgpp::endian Order>
+template <ndgpp::endian OtherOrder>
+inline
+constexpr
+ndgpp::endian_value<T, Order>::endian_value(const ndgpp::endian_value<T, OtherOrder> other) noexcept:
+    endian_value(static_cast<T>(other))
+{}
+
+template <class T, ndgpp::endian Order>
+inline
+ndgpp::endian_value<T, Order> & ndgpp::endian_value<T, Order>::operator= (const T value) noexcept
+{
+    this->value_ = ndgpp::endian_convert<Order>(bits_type::to_bits(value));
+    return *this;
+}
+
+template <class T, ndgpp::endian Order>
+inline
+constexpr
+ndgpp::endian_value<T, Order>::operator T() const noexcept
+{
+    return bits_type::from_bits(ndgpp::endian_convert<Order>(this->value_));
+}
+
+template <class T, ndgpp::endian Order>
+inline
+typename ndgpp::endian_value<T, Order>::storage_type const *
+ndgpp::endian_value<T, Order>::operator &() const noexcept
+{
+    return &this->value_;
+}
+
+template <class T, ndgpp::endian Order>
+inline
+typename ndgpp::endian_value<T, Order>::storage_type *
+ndgpp::endian_value<T, Order>::operator &() noexcept
+{
+    return &this->value_;
+}
+
+template <class T, ndgpp::endian Order>
+inline
+constexpr
+std::size_t ndgpp::endian_value<T, Order>::size() const noexcept
+{
+    return sizeof(T);
+}
+
+template <class T, ndgpp::endian Order>
+inline
+void ndgpp::endian_value<T, Order>::swap(ndgpp::endian_value<T, Order> & other) noexcept
+{
+    std::swap(this->value_, other.value_);
+}
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef LIBNDGPP_FRAME_DECODER_HPP
+#define LIBNDGPP_FRAME_DECODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/network_byte_order.hpp>
+
+namespace ndgpp
+{
+    /// A non-owning view of a frame's payload
+    class frame_view
+    {
+        public:
+
+        constexpr frame_view(uint8_t const * const data, const std::size_t size) noexcept;
+
+        /// Returns the first byte of the payload
+        constexpr uint8_t const * data() const noexcept;
+
+        /// Returns the size of the payload in bytes
+        constexpr std::size_t size() const noexcept;
+
+        private:
+
+        uint8_t const * data_;
+        std::size_t size_;
+    };
+
+    inline constexpr frame_view::frame_view(uint8_t const * const data, const std::size_t size) noexcept:
+        data_(data),
+        size_(size)
+    {}
+
+    inline constexpr uint8_t const * frame_view::data() const noexcept
+    {
+        return this->data_;
+    }
+
+    inline constexpr std::size_t frame_view::size() const noexcept
+    {
+        return this->size_;
+    }
+
+    /** Splits a byte stream into frames that have a length prefix
+     *
+     *  Each frame is a ndgpp::network_byte_order<T> length followed
+     *  by length bytes of payload.  The stream is fed to the decoder
+     *  in chunks of any size, and the decoder passes each complete
+     *  frame to a handler:
+     *
+     *  \code
+     *  ndgpp::frame_decoder<uint32_t> decoder {max_frame_size};
+     *  const ssize_t received = recv(fd, buf, sizeof(buf), 0);
+     *  decoder.feed(buf, received, [] (const ndgpp::frame_view frame) {
+     *      process(frame.data(), frame.size());
+     *  });
+     *
+     *  Frames that are fully contained in a chunk are passed to the
+     *  handler as views of the chunk, so they are not copied.  Only
+     *  frames that straddle chunks are copied into an internal
+     *  buffer, which is reused between frames.  A frame_view is
+     *  only valid during the handler call.
+     *
+     *  @tparam T The type of the length prefix, uint16_t or uint32_t
+     */
+    template <class T>
+    class frame_decoder
+    {
+        static_assert(std::is_same<T, uint16_t>::value || std::is_same<T, uint32_t>::value,
+                      "T is not uint16_t or uint32_t");
+
+        public:
+
+        /// The size of the length prefix in bytes
+        static constexpr std::size_t prefix_size = sizeof(T);
+
+        /** Constructs a frame_decoder
+         *
+         *  @param max_frame_size The largest payload size accepted
+         */
+        explicit
+        frame_decoder(const std::size_t max_frame_size = std::numeric_limits<T>::max());
+
+        /** Decodes the frames in a chunk of the stream
+         *
+         *  @param data The chunk's data
+         *  @param size The size of the chunk in bytes
+         *  @param handler A callable that accepts a ndgpp::frame_view
+         *
+         *  @return The number of frames passed to the handler
+         *
+         *  @throw ndgpp::error<std::length_error> if a frame is larger
+         *         than the maximum frame size.  The decoder must be reset
+         *         before it is fed again.
+         */
+        template <class Handler>
+        std::size_t feed(uint8_t const * const data, const std::size_t size, Handler && handler);
+
+        /// Returns the number of bytes of an incomplete frame held by the decoder
+        std::size_t buffered() const noexcept;
+
+        /// Returns the largest payload size accepted
+        std::size_t max_frame_size() const noexcept;
+
+        /// Discards any buffered data
+        void reset() noexcept;
+
+        private:
+
+        std::size_t frame_size(uint8_t const * const prefix) const;
+
+        std::vector<uint8_t> buffer_;
+        std::size_t max_frame_size_;
+    };
+
+    template <class T>
+    constexpr std::size_t frame_decoder<T>::prefix_size;
+
+    template <class T>
+    inline frame_decoder<T>::frame_decoder(const std::size_t max_frame_size):
+        max_frame_size_(max_frame_size)
+    {
+        this->buffer_.reserve(prefix_size);
+    }
+
+    template <class T>
+    template <class Handler>
+    std::size_t frame_decoder<T>::feed(uint8_t const * const data, const std::size_t size, Handler && handler)
+    {
+        uint8_t const * position = data;
+        uint8_t const * const end = data + size;
+        std::size_t frames = 0;
+
+        if (!this->buffer_.empty())
+        {
+            // Complete the frame that straddles the previous chunk
+            if (this->buffer_.size() < prefix_size)
+            {
+                const std::size_t count = std::min<std::size_t>(prefix_size - this->buffer_.size(), end - position);
+                this->buffer_.insert(this->buffer_.end(), position, position + count);
+                position += count;
+                if (this->buffer_.size() < prefix_size)
+                {
+                    return frames;
+                }
+            }
+
+            const std::size_t payload_size = this->frame_size(this->buffer_.data());
+            const std::size_t count = std::min<std::size_t>(prefix_size + payload_size - this->buffer_.size(), end - position);
+            this->buffer_.insert(this->buffer_.end(), position, position + count);
+            position += count;
+            if (this->buffer_.size() < prefix_size + payload_size)
+            {
+                return frames;
+            }
+
+            handler(ndgpp::frame_view {this->buffer_.data() + prefix_size, payload_size});
+            this->buffer_.clear();
+            ++frames;
+        }
+
+        while (static_cast<std::size_t>(end - position) >= prefix_size)
+        {
+            const std::size_t payload_size = this->frame_size(position);
+            if (static_cast<std::size_t>(end - position) - prefix_size < payload_size)
+            {
+                break;
+            }
+
+            handler(ndgpp::frame_view {position + prefix_size, payload_size});
+            position += prefix_size + payload_size;
+            ++frames;
+        }
+
+        this->buffer_.assign(position, end);
+        return frames;
+    }
+
+    template <class T>
+    inline std::size_t frame_decoder<T>::buffered() const noexcept
+    {
+        return this->buffer_.size();
+    }
+
+    template <class T>
+    inline std::size_t frame_decoder<T>::max_frame_size() const noexcept
+    {
+        return this->max_frame_size_;
+    }
+
+    template <class T>
+    inline void frame_decoder<T>::reset() noexcept
+    {
+        this->buffer_.clear();
+    }
+
+    template <class T>
+    inline std::size_t frame_decoder<T>::frame_size(uint8_t const * const prefix) const
+    {
+        ndgpp::network_byte_order<T> length;
+        std::memcpy(&length, prefix, prefix_size);
+
+        const std::size_t size = static_cast<T>(length);
+        if (size > this->max_frame_size_)
+        {
+            throw ndgpp_error(std::length_error, "frame size exceeds the maximum frame size");
+        }
+
+        return size;
+    }
+}
+
+#endif
@@ -0,0 +1,262 @@
+#ifndef LIBNDGPP_IOVEC_BUILDER_HPP
+#define LIBNDGPP_IOVEC_BUILDER_HPP
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#include <libndgpp/algorithm/accumulate.hpp>
+#include <libndgpp/buffer_traits.hpp>
+#include <libndgpp/error.hpp>
+
+namespace ndgpp
+{
+    /** Builds struct iovec arrays for scatter-gather sends
+     *
+     *  Headers are written into a scratch area held by the builder,
+     *  and payloads are referenced by pointer so they are not
+     *  copied.  Several messages can be built in one batch:
+     *
+     *  \code
+     *  ndgpp::iovec_builder<> builder;
+     *  for (const auto & record: records)
+     *  {
+     *      builder.put(ndgpp::network_byte_order<uint16_t> {record.type},
+     *                  ndgpp::network_byte_order<uint32_t> {record.size});
+     *      builder.payload(record.data, record.size);
+     *      builder.end_message();
+     *  }
+     *
+     *  for (std::size_t i = 0; i < builder.message_count(); ++i)
+     *  {
+     *      builder.fill(msgs[i].msg_hdr, i);
+     *  }
+     *
+     *  sendmmsg(fd, msgs, builder.message_count(), 0);
+     *
+     *  The iovecs refer to the builder's scratch area, so the
+     *  builder can not be copied or moved.
+     *
+     *  @tparam ScratchSize The size in bytes of the scratch area
+     *  @tparam MaxIovecs The maximum number of iovecs for all messages
+     *  @tparam MaxMessages The maximum number of messages
+     */
+    template <std::size_t ScratchSize = 1024,
+              std::size_t MaxIovecs = 64,
+              std::size_t MaxMessages = 32>
+    class iovec_builder
+    {
+        public:
+
+        iovec_builder() noexcept;
+
+        iovec_builder(const iovec_builder &) = delete;
+        iovec_builder(iovec_builder &&) = delete;
+
+        iovec_builder & operator = (const iovec_builder &) = delete;
+        iovec_builder & operator = (iovec_builder &&) = delete;
+
+        /** Reserves size bytes of the scratch area for a header and appends them to the message
+         *
+         *  @return The reserved bytes, which the caller writes the header to
+         *
+         *  @throw ndgpp::error<std::length_error> if the scratch area
+         *         or iovec array is full
+         */
+        uint8_t * header(const std::size_t size);
+
+        /** Writes the values to the scratch area and appends them to the message
+         *
+         *  The values are written with ndgpp::buffer_traits.
+         *
+         *  @throw ndgpp::error<std::length_error> if the scratch area
+         *         or iovec array is full
+         */
+        template <class ... Ts>
+        iovec_builder & put(const Ts & ... values);
+
+        /** Appends a reference to a payload to the message
+         *
+         *  The payload must remain valid until the iovecs are sent.
+         *
+         *  @throw ndgpp::error<std::length_error> if the iovec array is full
+         */
+        iovec_builder & payload(void const * const data, const std::size_t size);
+
+        /** Ends the current message
+         *
+         *  @throw ndgpp::error<std::length_error> if the maximum number
+         *         of messages is reached
+         */
+        iovec_builder & end_message();
+
+        /// Returns the iovecs of every message, including the current message
+        const struct iovec * iovecs() const noexcept;
+
+        /// Returns the number of iovecs of every message, including the current message
+        std::size_t iovec_count() const noexcept;
+
+        /// Returns the number of messages ended with end_message
+        std::size_t message_count() const noexcept;
+
+        /// Returns the first iovec of the message at index
+        const struct iovec * message_iovecs(const std::size_t index) const noexcept;
+
+        /// Returns the number of iovecs of the message at index
+        std::size_t message_iovec_count(const std::size_t index) const noexcept;
+
+        /// Assigns msg_iov and msg_iovlen of hdr to the message at index
+        void fill(struct msghdr & hdr, const std::size_t index) const noexcept;
+
+        /// Removes every message and releases the scratch area
+        void clear() noexcept;
+
+        private:
+
+        void append(void const * const data, const std::size_t size);
+
+        std::array<uint8_t, ScratchSize> scratch_;
+        std::array<struct iovec, MaxIovecs> iovecs_;
+
+        /// The index of the first iovec after each message
+        std::array<std::size_t, MaxMessages> message_ends_;
+
+        std::size_t scratch_size_ = 0;
+        std::size_t iovec_count_ = 0;
+        std::size_t message_count_ = 0;
+    };
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::iovec_builder() noexcept = default;
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    uint8_t * iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::header(const std::size_t size)
+    {
+        if (size > ScratchSize - this->scratch_size_)
+        {
+            throw ndgpp_error(std::length_error, "iovec_builder scratch area is full");
+        }
+
+        uint8_t * const data = this->scratch_.data() + this->scratch_size_;
+        this->append(data, size);
+        this->scratch_size_ += size;
+        return data;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    template <class ... Ts>
+    iovec_builder<ScratchSize, MaxIovecs, MaxMessages> &
+    iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::put(const Ts & ... values)
+    {
+        uint8_t * data = this->header(ndgpp::accumulate(std::size_t {0}, std::size_t {ndgpp::buffer_traits<Ts>::size}...));
+
+        using expander = int[];
+        static_cast<void>(expander {0, (ndgpp::buffer_traits<Ts>::write(data, values),
+                                        data += ndgpp::buffer_traits<Ts>::size,
+                                        0)...});
+        return *this;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline iovec_builder<ScratchSize, MaxIovecs, MaxMessages> &
+    iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::payload(void const * const data, const std::size_t size)
+    {
+        this->append(data, size);
+        return *this;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline iovec_builder<ScratchSize, MaxIovecs, MaxMessages> &
+    iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::end_message()
+    {
+        if (this->message_count_ == MaxMessages)
+        {
+            throw ndgpp_error(std::length_error, "iovec_builder message limit reached");
+        }
+
+        this->message_ends_[this->message_count_] = this->iovec_count_;
+        ++this->message_count_;
+        return *this;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline const struct iovec * iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::iovecs() const noexcept
+    {
+        return this->iovecs_.data();
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline std::size_t iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::iovec_count() const noexcept
+    {
+        return this->iovec_count_;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline std::size_t iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::message_count() const noexcept
+    {
+        return this->message_count_;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline const struct iovec *
+    iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::message_iovecs(const std::size_t index) const noexcept
+    {
+        return this->iovecs_.data() + (index == 0 ? 0 : this->message_ends_[index - 1]);
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline std::size_t
+    iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::message_iovec_count(const std::size_t index) const noexcept
+    {
+        return this->message_ends_[index] - (index == 0 ? 0 : this->message_ends_[index - 1]);
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline void iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::fill(struct msghdr & hdr, const std::size_t index) const noexcept
+    {
+        hdr.msg_iov = const_cast<struct iovec *>(this->message_iovecs(index));
+        hdr.msg_iovlen = this->message_iovec_count(index);
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    inline void iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::clear() noexcept
+    {
+        this->scratch_size_ = 0;
+        this->iovec_count_ = 0;
+        this->message_count_ = 0;
+    }
+
+    template <std::size_t ScratchSize, std::size_t MaxIovecs, std::size_t MaxMessages>
+    void iovec_builder<ScratchSize, MaxIovecs, MaxMessages>::append(void const * const data, const std::size_t size)
+    {
+        const std::size_t message_start = this->message_count_ == 0 ? 0 : this->message_ends_[this->message_count_ - 1];
+        if (this->iovec_count_ > message_start)
+        {
+            // Extend the previous iovec if data follows it, which is
+            // the case for consecutive headers
+            struct iovec & last = this->iovecs_[this->iovec_count_ - 1];
+            if (static_cast<uint8_t const *>(last.iov_base) + last.iov_len == data)
+            {
+                last.iov_len += size;
+                return;
+            }
+        }
+
+        if (this->iovec_count_ == MaxIovecs)
+        {
+            throw ndgpp_error(std::length_error, "iovec_builder iovec array is full");
+        }
+
+        this->iovecs_[this->iovec_count_].iov_base = const_cast<void *>(data);
+        this->iovecs_[this->iovec_count_].iov_len = size;
+        ++this->iovec_count_;
+    }
+}
+
+#endif
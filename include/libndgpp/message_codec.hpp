@@ -0,0 +1,232 @@
+#ifndef LIBNDGPP_MESSAGE_CODEC_HPP
+#define LIBNDGPP_MESSAGE_CODEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <libndgpp/algorithm/accumulate.hpp>
+#include <libndgpp/buffer_traits.hpp>
+#include <libndgpp/tuple.hpp>
+
+namespace ndgpp
+{
+    template <class Schema>
+    class message_codec;
+
+    /** Encodes and decodes fixed layout messages described by a tuple of field types
+     *
+     *  Each field is written with ndgpp::buffer_traits in the order
+     *  it appears in the schema, without padding:
+     *
+     *  \code
+     *  using codec = ndgpp::message_codec<std::tuple<ndgpp::network_byte_order<uint32_t>,
+     *                                                ndgpp::net::ipv4_address,
+     *                                                ndgpp::net::port>>;
+     *
+     *  codec::encode(buf, codec::value_type {seq, addr, port});
+     *  const auto msg = codec::decode(buf);
+     *
+     *  Records laid out back to back can be decoded into one array
+     *  per field, which only touches the fields that are needed:
+     *
+     *  \code
+     *  std::vector<ndgpp::net::port> ports(count);
+     *  codec::decode_column<ndgpp::net::port>(buf, count, ports.data());
+     *
+     *  @tparam Ts The field types in wire order
+     */
+    template <class ... Ts>
+    class message_codec<std::tuple<Ts...>>
+    {
+        public:
+
+        /// The decoded message type
+        using value_type = std::tuple<Ts...>;
+
+        /// The type of the field at index I
+        template <std::size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        /// The encoded size of a message in bytes
+        static constexpr std::size_t size = ndgpp::accumulate(std::size_t {0}, std::size_t {ndgpp::buffer_traits<Ts>::size}...);
+
+        /** Provides the index of the field with type T
+         *
+         *  If T appears more than once in the schema, the index of the
+         *  first field is provided.
+         */
+        template <class T>
+        static constexpr std::size_t index() noexcept;
+
+        /// Provides the offset in bytes of the field at index I
+        template <std::size_t I>
+        static constexpr std::size_t offset() noexcept;
+
+        /// Writes msg to the size bytes at data
+        static void encode(uint8_t * const data, const value_type & msg);
+
+        /// Writes count messages to the count * size bytes at data
+        static void encode(uint8_t * const data, const value_type * const msgs, const std::size_t count);
+
+        /// Reads a message from the size bytes at data
+        static value_type decode(uint8_t const * const data);
+
+        /** Reads the field at index I of count records into out
+         *
+         *  @param data The first of count records laid out back to back
+         *  @param count The number of records
+         *  @param out The first of count field values
+         */
+        template <std::size_t I>
+        static void decode_column(uint8_t const * const data, const std::size_t count, field_type<I> * const out);
+
+        /// Reads the field with type T of count records into out
+        template <class T>
+        static void decode_column(uint8_t const * const data, const std::size_t count, T * const out);
+
+        /** Reads every field of count records into one array per field
+         *
+         *  A column that is nullptr is not decoded.
+         *
+         *  @param data The first of count records laid out back to back
+         *  @param count The number of records
+         *  @param columns The first of count values of each field
+         */
+        static void decode_columns(uint8_t const * const data, const std::size_t count, Ts * const ... columns);
+
+        private:
+
+        template <std::size_t ... Is>
+        static constexpr std::size_t offset(std::index_sequence<Is...>) noexcept;
+
+        template <std::size_t ... Is>
+        static void encode(uint8_t * const data, const value_type & msg, std::index_sequence<Is...>);
+
+        template <std::size_t ... Is>
+        static value_type decode(uint8_t const * const data, std::index_sequence<Is...>);
+
+        template <std::size_t ... Is>
+        static void decode_columns(uint8_t const * const data,
+                                   const std::size_t count,
+                                   std::index_sequence<Is...>,
+                                   Ts * const ... columns);
+    };
+
+    template <class ... Ts>
+    constexpr std::size_t message_codec<std::tuple<Ts...>>::size;
+
+    template <class ... Ts>
+    template <class T>
+    inline constexpr std::size_t message_codec<std::tuple<Ts...>>::index() noexcept
+    {
+        static_assert(ndgpp::tuple_contains<T, value_type>::value, "T is not a field of the schema");
+        return ndgpp::tuple_index<T, value_type>::value;
+    }
+
+    template <class ... Ts>
+    template <std::size_t I>
+    inline constexpr std::size_t message_codec<std::tuple<Ts...>>::offset() noexcept
+    {
+        return offset(std::make_index_sequence<I> {});
+    }
+
+    template <class ... Ts>
+    template <std::size_t ... Is>
+    inline constexpr std::size_t message_codec<std::tuple<Ts...>>::offset(std::index_sequence<Is...>) noexcept
+    {
+        return ndgpp::accumulate(std::size_t {0}, std::size_t {ndgpp::buffer_traits<field_type<Is>>::size}...);
+    }
+
+    template <class ... Ts>
+    inline void message_codec<std::tuple<Ts...>>::encode(uint8_t * const data, const value_type & msg)
+    {
+        encode(data, msg, std::index_sequence_for<Ts...> {});
+    }
+
+    template <class ... Ts>
+    inline void message_codec<std::tuple<Ts...>>::encode(uint8_t * const data,
+                                                         const value_type * const msgs,
+                                                         const std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            encode(data + i * size, msgs[i]);
+        }
+    }
+
+    template <class ... Ts>
+    template <std::size_t ... Is>
+    inline void message_codec<std::tuple<Ts...>>::encode(uint8_t * const data,
+                                                         const value_type & msg,
+                                                         std::index_sequence<Is...>)
+    {
+        using expander = int[];
+        static_cast<void>(expander {0, (ndgpp::buffer_traits<Ts>::write(data + offset<Is>(), std::get<Is>(msg)), 0)...});
+    }
+
+    template <class ... Ts>
+    inline typename message_codec<std::tuple<Ts...>>::value_type
+    message_codec<std::tuple<Ts...>>::decode(uint8_t const * const data)
+    {
+        return decode(data, std::index_sequence_for<Ts...> {});
+    }
+
+    template <class ... Ts>
+    template <std::size_t ... Is>
+    inline typename message_codec<std::tuple<Ts...>>::value_type
+    message_codec<std::tuple<Ts...>>::decode(uint8_t const * const data, std::index_sequence<Is...>)
+    {
+        return value_type {ndgpp::buffer_traits<Ts>::read(data + offset<Is>())...};
+    }
+
+    template <class ... Ts>
+    template <std::size_t I>
+    inline void message_codec<std::tuple<Ts...>>::decode_column(uint8_t const * const data,
+                                                                const std::size_t count,
+                                                                field_type<I> * const out)
+    {
+        // The stride and offset are constants, so this loop is a
+        // strided gather the compiler can unroll or vectorize
+        uint8_t const * field = data + offset<I>();
+        for (std::size_t i = 0; i < count; ++i, field += size)
+        {
+            out[i] = ndgpp::buffer_traits<field_type<I>>::read(field);
+        }
+    }
+
+    template <class ... Ts>
+    template <class T>
+    inline void message_codec<std::tuple<Ts...>>::decode_column(uint8_t const * const data,
+                                                                const std::size_t count,
+                                                                T * const out)
+    {
+        decode_column<index<T>()>(data, count, out);
+    }
+
+    template <class ... Ts>
+    inline void message_codec<std::tuple<Ts...>>::decode_columns(uint8_t const * const data,
+                                                                 const std::size_t count,
+                                                                 Ts * const ... columns)
+    {
+        decode_columns(data, count, std::index_sequence_for<Ts...> {}, columns...);
+    }
+
+    template <class ... Ts>
+    template <std::size_t ... Is>
+    inline void message_codec<std::tuple<Ts...>>::decode_columns(uint8_t const * const data,
+                                                                 const std::size_t count,
+                                                                 std::index_sequence<Is...>,
+                                                                 Ts * const ... columns)
+    {
+        // Decoding one column at a time keeps each output array's
+        // writes sequential
+        using expander = int[];
+        static_cast<void>(expander {0, (columns != nullptr ? decode_column<Is>(data, count, columns) : void(), 0)...});
+    }
+}
+
+#endif
@@ -2,14 +2,18 @@
 #define LIBNDGPP_NET_BASIC_IPV4_ADDRESS_HPP
 
 #include <cstdint>
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 
+#include <libndgpp/detail/hash_mix.hpp>
 #include <libndgpp/error.hpp>
 #include <libndgpp/net/ipv4_array.hpp>
+#include <libndgpp/to_chars_result.hpp>
 
 namespace ndgpp {
 namespace net {
@@ -42,6 +46,11 @@ namespace net {
     };
 
     /** IPv4 address value type
+     *
+     *  The address is stored as an unsigned 32 bit integer in host
+     *  byte order, so equality and ordering are single integer
+     *  comparisons.  The octets are still accessible with
+     *  operator[] and value.
      *
      *  @tparam Min The minimum address value in network byte order
      *  @tparam Max The maximum address value in network byte order
@@ -131,7 +140,7 @@ namespace net {
 
         private:
 
-        ndgpp::net::ipv4_array value_ = {ndgpp::net::make_ipv4_array(Min)};
+        uint32_t value_ = Min;
     };
 
     template <uint32_t Min, uint32_t Max>
@@ -140,7 +149,7 @@ namespace net {
     template <uint32_t Min, uint32_t Max>
     template <uint32_t MinO, uint32_t MaxO>
     constexpr basic_ipv4_address<Min, Max>::basic_ipv4_address(const basic_ipv4_address<MinO, MaxO> & addr) noexcept(MinO >= Min && MaxO <= Max):
-        value_ {addr.value()}
+        value_ {addr.to_uint32()}
     {
         if (!(MinO >= Min && MaxO <= Max))
         {
@@ -150,23 +159,23 @@ namespace net {
 
     template <uint32_t Min, uint32_t Max>
     constexpr basic_ipv4_address<Min, Max>::basic_ipv4_address(const ndgpp::net::ipv4_array value) noexcept(!basic_ipv4_address::constrained):
-         value_ {value}
+         value_ {ndgpp::net::to_uint32(value)}
     {
-        basic_ipv4_address_validator<Min, Max> {} (this->to_uint32());
+        basic_ipv4_address_validator<Min, Max> {} (this->value_);
     }
 
     template <uint32_t Min, uint32_t Max>
     constexpr basic_ipv4_address<Min, Max>::basic_ipv4_address(const uint32_t value) noexcept(!basic_ipv4_address::constrained):
-         value_ {ndgpp::net::make_ipv4_array(value)}
+         value_ {value}
     {
         basic_ipv4_address_validator<Min, Max> {} (value);
     }
 
     template <uint32_t Min, uint32_t Max>
     basic_ipv4_address<Min, Max>::basic_ipv4_address(const std::string & value):
-        value_ {ndgpp::net::make_ipv4_array(value)}
+        value_ {ndgpp::net::to_uint32(ndgpp::net::make_ipv4_array(value))}
     {
-        basic_ipv4_address_validator<Min, Max> {} (this->to_uint32());
+        basic_ipv4_address_validator<Min, Max> {} (this->value_);
     }
 
     template <uint32_t Min, uint32_t Max>
@@ -177,8 +186,8 @@ namespace net {
     basic_ipv4_address<Min, Max> &
     basic_ipv4_address<Min, Max>::operator = (const ndgpp::net::ipv4_array rhs) noexcept(!basic_ipv4_address::constrained)
     {
-        this->value_ = rhs;
-        basic_ipv4_address_validator<Min, Max> {} (this->to_uint32());
+        basic_ipv4_address_validator<Min, Max> {} (ndgpp::net::to_uint32(rhs));
+        this->value_ = ndgpp::net::to_uint32(rhs);
         return *this;
     }
 
@@ -186,8 +195,8 @@ namespace net {
     basic_ipv4_address<Min, Max> &
     basic_ipv4_address<Min, Max>::operator = (const uint32_t rhs) noexcept(!basic_ipv4_address::constrained)
     {
-        this->value_ = ndgpp::net::make_ipv4_array(rhs);
         basic_ipv4_address_validator<Min, Max> {} (rhs);
+        this->value_ = rhs;
         return *this;
     }
 
@@ -195,8 +204,9 @@ namespace net {
     basic_ipv4_address<Min, Max> &
     basic_ipv4_address<Min, Max>::operator = (const std::string & rhs)
     {
-        this->value_ = ndgpp::net::make_ipv4_array(rhs);
-        basic_ipv4_address_validator<Min, Max> {} (this->to_uint32());
+        const uint32_t value = ndgpp::net::to_uint32(ndgpp::net::make_ipv4_array(rhs));
+        basic_ipv4_address_validator<Min, Max> {} (value);
+        this->value_ = value;
         return *this;
     }
 
@@ -209,26 +219,26 @@ namespace net {
     template <uint32_t Min, uint32_t Max>
     inline constexpr uint8_t basic_ipv4_address<Min, Max>::operator [] (const std::size_t index) const noexcept
     {
-        return this->value_[index];
+        return static_cast<uint8_t>(this->value_ >> (24 - 8 * index));
     }
 
     template <uint32_t Min, uint32_t Max>
     inline constexpr ndgpp::net::ipv4_array
     basic_ipv4_address<Min, Max>::value() const noexcept
     {
-        return this->value_;
+        return ndgpp::net::make_ipv4_array(this->value_);
     }
 
     template <uint32_t Min, uint32_t Max>
     inline constexpr uint32_t basic_ipv4_address<Min, Max>::to_uint32() const noexcept
     {
-        return ndgpp::net::to_uint32(this->value_);
+        return this->value_;
     }
 
     template <uint32_t Min, uint32_t Max>
     inline std::string basic_ipv4_address<Min, Max>::to_string() const
     {
-        return ndgpp::net::to_string(this->value_);
+        return ndgpp::net::to_string(this->value());
     }
 
     template <uint32_t Min, uint32_t Max>
@@ -238,23 +248,61 @@ namespace net {
         lhs.swap(rhs);
     }
 
+    /// Writes the dotted quad form of an address to [first, last)
     template <uint32_t Min, uint32_t Max>
-    inline std::ostream & operator <<(std::ostream & stream, const basic_ipv4_address<Min, Max> address)
+    inline ndgpp::to_chars_result to_chars(char * const first, char * const last, const basic_ipv4_address<Min, Max> address) noexcept
     {
-        stream << static_cast<uint16_t>(address[0]);
-        for (std::size_t i = 1; i < std::tuple_size<typename ndgpp::net::basic_ipv4_address<Min, Max>::value_type>::value; ++i)
+        return ndgpp::net::to_chars(first, last, address.value());
+    }
+
+    /** Writes the dotted quad form of count addresses to [first, last)
+     *
+     *  Each address is followed by separator.  If the addresses do
+     *  not all fit, the buffer holds the addresses that fit.
+     */
+    template <uint32_t Min, uint32_t Max>
+    ndgpp::to_chars_result to_chars(char * const first,
+                                    char * const last,
+                                    basic_ipv4_address<Min, Max> const * const addresses,
+                                    const std::size_t count,
+                                    const char separator = '\n') noexcept
+    {
+        // Format in chunks of arrays so the bulk array overload does the work
+        std::array<ndgpp::net::ipv4_array, 64> values;
+        char * position = first;
+        for (std::size_t i = 0; i < count; i += values.size())
         {
-            stream.put('.');
-            stream << static_cast<uint16_t>(address[i]);
+            const std::size_t chunk = std::min(values.size(), count - i);
+            for (std::size_t j = 0; j < chunk; ++j)
+            {
+                values[j] = addresses[i + j].value();
+            }
+
+            const ndgpp::to_chars_result result = ndgpp::net::to_chars(position, last, values.data(), chunk, separator);
+            if (result.ec != std::errc {})
+            {
+                return result;
+            }
+
+            position = result.ptr;
         }
 
+        return {position, std::errc {}};
+    }
+
+    template <uint32_t Min, uint32_t Max>
+    inline std::ostream & operator <<(std::ostream & stream, const basic_ipv4_address<Min, Max> address)
+    {
+        std::array<char, ndgpp::net::ipv4_max_chars> buffer;
+        const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), address);
+        stream.write(buffer.data(), result.ptr - buffer.data());
         return stream;
     }
 
     template <uint32_t Min, uint32_t Max>
     inline bool operator ==(const basic_ipv4_address<Min, Max> lhs, const basic_ipv4_address<Min, Max> rhs)
     {
-        return lhs.value() == rhs.value();
+        return lhs.to_uint32() == rhs.to_uint32();
     }
 
     template <uint32_t Min, uint32_t Max>
@@ -266,7 +314,7 @@ namespace net {
     template <uint32_t Min, uint32_t Max>
     inline bool operator <(const basic_ipv4_address<Min, Max> lhs, const basic_ipv4_address<Min, Max> rhs)
     {
-        return lhs.value() < rhs.value();
+        return lhs.to_uint32() < rhs.to_uint32();
     }
 
     template <uint32_t Min, uint32_t Max>
@@ -288,4 +336,25 @@ namespace net {
     }
 }}
 
+namespace std
+{
+    template <uint32_t Min, uint32_t Max>
+    struct hash<ndgpp::net::basic_ipv4_address<Min, Max>> final
+    {
+        using argument_type = ndgpp::net::basic_ipv4_address<Min, Max>;
+        using result_type = std::size_t;
+
+        /** Returns the hash of an address
+         *
+         *  std::hash of an integer is the identity, which clusters
+         *  addresses from the same subnet in the low bits, so the
+         *  address is mixed first.
+         */
+        result_type operator() (const argument_type address) const noexcept
+        {
+            return static_cast<result_type>(ndgpp::detail::hash_mix(address.to_uint32()));
+        }
+    };
+}
+
 #endif
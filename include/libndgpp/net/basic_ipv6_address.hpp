@@ -0,0 +1,319 @@
+#ifndef LIBNDGPP_NET_BASIC_IPV6_ADDRESS_HPP
+#define LIBNDGPP_NET_BASIC_IPV6_ADDRESS_HPP
+
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <libndgpp/detail/hash_mix.hpp>
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv6_array.hpp>
+#include <libndgpp/to_chars_result.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    template <uint64_t Min, uint64_t Max>
+    struct basic_ipv6_address_validator
+    {
+        constexpr
+        bool
+        operator () (uint64_t high)
+        {
+            if (high < Min || high > Max)
+            {
+                throw ndgpp_error(std::out_of_range, "supplied address out of range");
+            }
+
+            return true;
+        }
+    };
+
+    template <>
+    struct basic_ipv6_address_validator<0, 0xffffffffffffffff>
+    {
+        constexpr
+        bool
+        operator () (uint64_t high) noexcept
+        {
+            return true;
+        }
+    };
+
+    /** IPv6 address value type
+     *
+     *  The address is stored as two unsigned 64 bit integers in host
+     *  byte order, so equality and ordering are two integer
+     *  comparisons.  The bytes are still accessible with operator[]
+     *  and value.
+     *
+     *  The range constraint applies to the most significant 64 bits
+     *  of the address, which hold the routing prefix, so an address
+     *  is valid if Min <= high() <= Max.  For example the multicast
+     *  addresses, ff00::/8, are constrained like so:
+     *
+     *  \code
+     *  using multicast_ipv6_address = basic_ipv6_address<0xff00000000000000, 0xffffffffffffffff>;
+     *
+     *  @tparam Min The minimum value of the address's most significant 64 bits
+     *  @tparam Max The maximum value of the address's most significant 64 bits
+     *
+     *  @par Move Semantics
+     *  Move operations behave just like copy operations
+     */
+    template <uint64_t Min = 0, uint64_t Max = 0xffffffffffffffff>
+    class basic_ipv6_address final
+    {
+        public:
+
+        using value_type = ndgpp::net::ipv6_array;
+
+        /// The minimum value of the address's most significant 64 bits
+        static constexpr uint64_t min = Min;
+
+        /// The maximum value of the address's most significant 64 bits
+        static constexpr uint64_t max = Max;
+
+        using constrained_bool_type = std::conditional_t<Min == 0x0 && Max == 0xffffffffffffffff,
+                                                         std::false_type,
+                                                         std::true_type>;
+
+        static constexpr bool constrained = constrained_bool_type::value;
+
+        /// Constructs an address whose most significant 64 bits are Min and least significant 64 bits are zero
+        constexpr basic_ipv6_address() noexcept;
+
+        template <uint64_t MinO, uint64_t MaxO>
+        constexpr basic_ipv6_address(const basic_ipv6_address<MinO, MaxO> & other) noexcept(MinO >= Min && MaxO <= Max);
+
+        /// Constructs an address assigned to the value provided
+        constexpr basic_ipv6_address(const value_type value) noexcept(!constrained);
+
+        /** Constructs an address from two unsigned 64 bit integers
+         *
+         *  @param high The most significant 64 bits, i.e. bytes 0 through 7
+         *  @param low The least significant 64 bits, i.e. bytes 8 through 15
+         */
+        explicit
+        constexpr basic_ipv6_address(const uint64_t high, const uint64_t low) noexcept(!constrained);
+
+        /** Constructs an address from a string
+         *
+         *  @param value A string representing an IPv6 address in the
+         *               text form described in RFC 4291
+         */
+        explicit
+        basic_ipv6_address(const std::string & value);
+
+        basic_ipv6_address & operator = (const basic_ipv6_address & value) noexcept;
+
+        /// Assignes the address based on the value_type value
+        basic_ipv6_address & operator = (const value_type value) noexcept(!constrained);
+
+        /// Assignes the address based on the passed in string value
+        basic_ipv6_address & operator = (const std::string & value);
+
+        void swap(basic_ipv6_address & other) noexcept;
+
+        constexpr uint8_t operator[] (const std::size_t index) const noexcept;
+
+        constexpr ndgpp::net::ipv6_array value() const noexcept;
+
+        /// Returns the most significant 64 bits of the address
+        constexpr uint64_t high() const noexcept;
+
+        /// Returns the least significant 64 bits of the address
+        constexpr uint64_t low() const noexcept;
+
+        /// Returns the canonical text form of the address
+        std::string to_string() const;
+
+        private:
+
+        uint64_t high_ = Min;
+        uint64_t low_ = 0;
+    };
+
+    template <uint64_t Min, uint64_t Max>
+    constexpr basic_ipv6_address<Min, Max>::basic_ipv6_address() noexcept = default;
+
+    template <uint64_t Min, uint64_t Max>
+    template <uint64_t MinO, uint64_t MaxO>
+    constexpr basic_ipv6_address<Min, Max>::basic_ipv6_address(const basic_ipv6_address<MinO, MaxO> & addr) noexcept(MinO >= Min && MaxO <= Max):
+        high_ {addr.high()},
+        low_ {addr.low()}
+    {
+        if (!(MinO >= Min && MaxO <= Max))
+        {
+            basic_ipv6_address_validator<Min, Max> {} (this->high_);
+        }
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    constexpr basic_ipv6_address<Min, Max>::basic_ipv6_address(const ndgpp::net::ipv6_array value) noexcept(!basic_ipv6_address::constrained):
+        high_ {ndgpp::net::ipv6_high(value)},
+        low_ {ndgpp::net::ipv6_low(value)}
+    {
+        basic_ipv6_address_validator<Min, Max> {} (this->high_);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    constexpr basic_ipv6_address<Min, Max>::basic_ipv6_address(const uint64_t high, const uint64_t low) noexcept(!basic_ipv6_address::constrained):
+        high_ {high},
+        low_ {low}
+    {
+        basic_ipv6_address_validator<Min, Max> {} (high);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    basic_ipv6_address<Min, Max>::basic_ipv6_address(const std::string & value):
+        basic_ipv6_address(ndgpp::net::make_ipv6_array(value))
+    {}
+
+    template <uint64_t Min, uint64_t Max>
+    basic_ipv6_address<Min, Max> &
+    basic_ipv6_address<Min, Max>::operator = (const basic_ipv6_address &) noexcept = default;
+
+    template <uint64_t Min, uint64_t Max>
+    basic_ipv6_address<Min, Max> &
+    basic_ipv6_address<Min, Max>::operator = (const ndgpp::net::ipv6_array rhs) noexcept(!basic_ipv6_address::constrained)
+    {
+        const uint64_t high = ndgpp::net::ipv6_high(rhs);
+        basic_ipv6_address_validator<Min, Max> {} (high);
+        this->high_ = high;
+        this->low_ = ndgpp::net::ipv6_low(rhs);
+        return *this;
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    basic_ipv6_address<Min, Max> &
+    basic_ipv6_address<Min, Max>::operator = (const std::string & rhs)
+    {
+        return *this = ndgpp::net::make_ipv6_array(rhs);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    void basic_ipv6_address<Min, Max>::swap(basic_ipv6_address & other) noexcept
+    {
+        std::swap(this->high_, other.high_);
+        std::swap(this->low_, other.low_);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline constexpr uint8_t basic_ipv6_address<Min, Max>::operator [] (const std::size_t index) const noexcept
+    {
+        return static_cast<uint8_t>((index < 8 ? this->high_ : this->low_) >> (56 - 8 * (index % 8)));
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline constexpr ndgpp::net::ipv6_array
+    basic_ipv6_address<Min, Max>::value() const noexcept
+    {
+        return ndgpp::net::make_ipv6_array(this->high_, this->low_);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline constexpr uint64_t basic_ipv6_address<Min, Max>::high() const noexcept
+    {
+        return this->high_;
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline constexpr uint64_t basic_ipv6_address<Min, Max>::low() const noexcept
+    {
+        return this->low_;
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline std::string basic_ipv6_address<Min, Max>::to_string() const
+    {
+        return ndgpp::net::to_string(this->value());
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    void swap(basic_ipv6_address<Min, Max> & lhs,
+              basic_ipv6_address<Min, Max> & rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    /// Writes the canonical text form of an address to [first, last)
+    template <uint64_t Min, uint64_t Max>
+    inline ndgpp::to_chars_result to_chars(char * const first, char * const last, const basic_ipv6_address<Min, Max> address) noexcept
+    {
+        return ndgpp::net::to_chars(first, last, address.value());
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline std::ostream & operator <<(std::ostream & stream, const basic_ipv6_address<Min, Max> address)
+    {
+        std::array<char, ndgpp::net::ipv6_max_chars> buffer;
+        const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), address);
+        stream.write(buffer.data(), result.ptr - buffer.data());
+        return stream;
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline bool operator ==(const basic_ipv6_address<Min, Max> lhs, const basic_ipv6_address<Min, Max> rhs)
+    {
+        return lhs.high() == rhs.high() && lhs.low() == rhs.low();
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline bool operator !=(const basic_ipv6_address<Min, Max> lhs, const basic_ipv6_address<Min, Max> rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline bool operator <(const basic_ipv6_address<Min, Max> lhs, const basic_ipv6_address<Min, Max> rhs)
+    {
+        return lhs.high() < rhs.high() || (lhs.high() == rhs.high() && lhs.low() < rhs.low());
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline bool operator >=(const basic_ipv6_address<Min, Max> lhs, const basic_ipv6_address<Min, Max> rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline bool operator >(const basic_ipv6_address<Min, Max> lhs, const basic_ipv6_address<Min, Max> rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <uint64_t Min, uint64_t Max>
+    inline bool operator <=(const basic_ipv6_address<Min, Max> lhs, const basic_ipv6_address<Min, Max> rhs)
+    {
+        return !(rhs < lhs);
+    }
+}}
+
+namespace std
+{
+    template <uint64_t Min, uint64_t Max>
+    struct hash<ndgpp::net::basic_ipv6_address<Min, Max>> final
+    {
+        using argument_type = ndgpp::net::basic_ipv6_address<Min, Max>;
+        using result_type = std::size_t;
+
+        /** Returns the hash of an address
+         *
+         *  The low half is mixed before it is combined with the high
+         *  half, so addresses in the same subnet that differ only in
+         *  their interface identifier are spread across the result.
+         */
+        result_type operator() (const argument_type address) const noexcept
+        {
+            return static_cast<result_type>(ndgpp::detail::hash_mix(address.high() ^ ndgpp::detail::hash_mix(address.low())));
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef LIBNDGPP_NET_INTERNET_CHECKSUM_HPP
+#define LIBNDGPP_NET_INTERNET_CHECKSUM_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <libndgpp/network_byte_order.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /** Returns the 16 bit ones' complement sum of a buffer
+     *
+     *  The sum is not complemented, so it can be used to chain sums
+     *  of several buffers, i.e. a pseudo header followed by a
+     *  payload.  Every buffer except for the last one must have an
+     *  even size.
+     *
+     *  @param data The buffer to sum
+     *  @param size The size of the buffer in bytes
+     *  @param initial The sum to add the buffer's sum to
+     */
+    ndgpp::network_byte_order<uint16_t>
+    ones_complement_sum(void const * const data,
+                        const std::size_t size,
+                        const ndgpp::network_byte_order<uint16_t> initial = ndgpp::network_byte_order<uint16_t> {0}) noexcept;
+
+    /** Returns the RFC 1071 internet checksum of a buffer
+     *
+     *  @param data The buffer to checksum
+     *  @param size The size of the buffer in bytes
+     */
+    ndgpp::network_byte_order<uint16_t>
+    internet_checksum(void const * const data, const std::size_t size) noexcept;
+
+    namespace detail
+    {
+        inline uint16_t fold_ones_complement_sum(uint32_t sum) noexcept
+        {
+            sum = (sum & 0xffff) + (sum >> 16);
+            sum = (sum & 0xffff) + (sum >> 16);
+            return static_cast<uint16_t>(sum);
+        }
+    }
+
+    /** Returns a checksum updated for a modified 16 bit field
+     *
+     *  The update is computed as described by equation 3 in RFC
+     *  1624, so the cost does not depend on the size of the
+     *  checksummed data.
+     *
+     *  @param checksum The checksum before the field was modified
+     *  @param old_value The field's value before it was modified
+     *  @param new_value The field's value after it was modified
+     */
+    inline ndgpp::network_byte_order<uint16_t>
+    internet_checksum_update(const ndgpp::network_byte_order<uint16_t> checksum,
+                             const ndgpp::network_byte_order<uint16_t> old_value,
+                             const ndgpp::network_byte_order<uint16_t> new_value) noexcept
+    {
+        // HC' = ~(~HC + ~m + m')
+        const uint32_t sum =
+            static_cast<uint16_t>(~static_cast<uint16_t>(checksum)) +
+            static_cast<uint16_t>(~static_cast<uint16_t>(old_value)) +
+            static_cast<uint32_t>(static_cast<uint16_t>(new_value));
+
+        return ndgpp::network_byte_order<uint16_t> {
+            static_cast<uint16_t>(~detail::fold_ones_complement_sum(sum))};
+    }
+
+    /** Returns a checksum updated for a modified 32 bit field
+     *
+     *  The field must start at an even offset in the checksummed
+     *  data, which is the case for IPv4 addresses in IPv4 headers
+     *  and pseudo headers.
+     *
+     *  @param checksum The checksum before the field was modified
+     *  @param old_value The field's value before it was modified
+     *  @param new_value The field's value after it was modified
+     */
+    inline ndgpp::network_byte_order<uint16_t>
+    internet_checksum_update(const ndgpp::network_byte_order<uint16_t> checksum,
+                             const ndgpp::network_byte_order<uint32_t> old_value,
+                             const ndgpp::network_byte_order<uint32_t> new_value) noexcept
+    {
+        const uint32_t old_host = old_value;
+        const uint32_t new_host = new_value;
+        const uint32_t sum =
+            static_cast<uint16_t>(~static_cast<uint16_t>(checksum)) +
+            static_cast<uint16_t>(~(old_host >> 16)) +
+            static_cast<uint16_t>(~old_host) +
+            (new_host >> 16) +
+            (new_host & 0xffff);
+
+        return ndgpp::network_byte_order<uint16_t> {
+            static_cast<uint16_t>(~detail::fold_ones_complement_sum(sum))};
+    }
+}}
+
+#endif
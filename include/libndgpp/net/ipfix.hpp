@@ -0,0 +1,324 @@
+#ifndef LIBNDGPP_NET_IPFIX_HPP
+#define LIBNDGPP_NET_IPFIX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <libndgpp/buffer_writer.hpp>
+#include <libndgpp/error.hpp>
+#include <libndgpp/message_codec.hpp>
+#include <libndgpp/network_byte_order.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /// The IPFIX protocol version number
+    constexpr uint16_t ipfix_version = 10;
+
+    /// The size of an IPFIX message header in bytes
+    constexpr std::size_t ipfix_message_header_size = 16;
+
+    /// The size of an IPFIX set header in bytes
+    constexpr std::size_t ipfix_set_header_size = 4;
+
+    /// The set ID of an IPFIX template set
+    constexpr uint16_t ipfix_template_set_id = 2;
+
+    /** Declares a field of an IPFIX template
+     *
+     *  The field's length is the size ndgpp::buffer_traits writes
+     *  for T, i.e. four for an IPv4 address.
+     *
+     *  @tparam Id The field's information element identifier
+     *  @tparam T The field's type i.e. ndgpp::net::ipv4_address,
+     *            ndgpp::net::port, ndgpp::network_byte_order<uint64_t>
+     */
+    template <uint16_t Id, class T>
+    struct ipfix_field
+    {
+        static constexpr uint16_t id = Id;
+        using value_type = T;
+    };
+
+    /** Describes an IPFIX template as an ordered list of fields
+     *
+     *  \code
+     *  using flow_template = ndgpp::net::ipfix_template<256,
+     *      ndgpp::net::ipfix_field<8, ndgpp::net::ipv4_address>,            // sourceIPv4Address
+     *      ndgpp::net::ipfix_field<12, ndgpp::net::ipv4_address>,           // destinationIPv4Address
+     *      ndgpp::net::ipfix_field<7, ndgpp::net::port>,                    // sourceTransportPort
+     *      ndgpp::net::ipfix_field<11, ndgpp::net::port>,                   // destinationTransportPort
+     *      ndgpp::net::ipfix_field<1, ndgpp::network_byte_order<uint64_t>>>; // octetDeltaCount
+     *
+     *  @tparam Id The template ID, which must be at least 256
+     *  @tparam Fields The ndgpp::net::ipfix_field types in record order
+     */
+    template <uint16_t Id, class ... Fields>
+    struct ipfix_template
+    {
+        static_assert(Id >= 256, "IPFIX template IDs less than 256 are reserved");
+        static_assert(sizeof...(Fields) > 0, "an IPFIX template needs at least one field");
+
+        /// The template ID, which is also the set ID of its data sets
+        static constexpr uint16_t id = Id;
+
+        /// The type of a data record
+        using record_type = std::tuple<typename Fields::value_type...>;
+
+        /// Encodes and decodes data records
+        using codec_type = ndgpp::message_codec<record_type>;
+
+        /// The size of a data record in bytes
+        static constexpr std::size_t record_size = codec_type::size;
+
+        /// The size in bytes of a template set that contains only this template
+        static constexpr std::size_t template_set_size = ipfix_set_header_size + 4 + 4 * sizeof...(Fields);
+
+        /// Writes a template set that contains only this template to the template_set_size bytes at data
+        static void write_template_set(uint8_t * const data) noexcept;
+    };
+
+    template <uint16_t Id, class T>
+    constexpr uint16_t ipfix_field<Id, T>::id;
+
+    template <uint16_t Id, class ... Fields>
+    constexpr uint16_t ipfix_template<Id, Fields...>::id;
+
+    template <uint16_t Id, class ... Fields>
+    constexpr std::size_t ipfix_template<Id, Fields...>::record_size;
+
+    template <uint16_t Id, class ... Fields>
+    constexpr std::size_t ipfix_template<Id, Fields...>::template_set_size;
+
+    template <uint16_t Id, class ... Fields>
+    inline void ipfix_template<Id, Fields...>::write_template_set(uint8_t * const data) noexcept
+    {
+        using u16 = ndgpp::network_byte_order<uint16_t>;
+
+        ndgpp::buffer_writer writer {data, template_set_size};
+        writer.put(ndgpp::unchecked, u16 {ipfix_template_set_id});
+        writer.put(ndgpp::unchecked, u16 {static_cast<uint16_t>(template_set_size)});
+        writer.put(ndgpp::unchecked, u16 {Id});
+        writer.put(ndgpp::unchecked, u16 {static_cast<uint16_t>(sizeof...(Fields))});
+
+        using expander = int[];
+        static_cast<void>(expander {0, (writer.put(ndgpp::unchecked, u16 {Fields::id}),
+                                        writer.put(ndgpp::unchecked, u16 {static_cast<uint16_t>(ndgpp::buffer_traits<typename Fields::value_type>::size)}),
+                                        0)...});
+    }
+
+    /** Packs data records of one template into IPFIX messages
+     *
+     *  Records are encoded directly into a message buffer that is
+     *  allocated once at construction.  A message is passed to the
+     *  sink when it can not hold another record, or when flush is
+     *  called.  The sink is any type that provides:
+     *
+     *  \code
+     *  void write(uint8_t const * data, std::size_t size);
+     *
+     *  The template is sent in the first message, and again every
+     *  template_refresh messages so collectors that join late, or
+     *  that lost the template over UDP, can decode the records.
+     *
+     *  \code
+     *  ndgpp::net::ipfix_file_sink sink {"flows.ipfix"};
+     *  ndgpp::net::ipfix_encoder<flow_template, ndgpp::net::ipfix_file_sink> encoder {sink, domain_id};
+     *  encoder.add(flow_template::record_type {src, dst, sport, dport, octets});
+     *  encoder.flush();
+     *
+     *  @tparam Template The ndgpp::net::ipfix_template of the records
+     *  @tparam Sink The type messages are written to
+     */
+    template <class Template, class Sink>
+    class ipfix_encoder
+    {
+        public:
+
+        using template_type = Template;
+        using record_type = typename Template::record_type;
+        using sink_type = Sink;
+
+        /** Constructs an ipfix_encoder
+         *
+         *  @param sink The sink messages are written to, which must outlive the encoder
+         *  @param observation_domain The observation domain ID of every message
+         *  @param max_message_size The maximum size of a message, i.e. the path MTU
+         *                          less the IP and UDP headers
+         *  @param template_refresh The number of messages sent between templates,
+         *                          zero sends the template only in the first message
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if a message with the
+         *         template and one record does not fit in max_message_size
+         */
+        ipfix_encoder(Sink & sink,
+                      const uint32_t observation_domain,
+                      const std::size_t max_message_size = 1472,
+                      const std::size_t template_refresh = 16);
+
+        ipfix_encoder(const ipfix_encoder &) = delete;
+        ipfix_encoder & operator = (const ipfix_encoder &) = delete;
+
+        /// Adds a record to the current message, writing the message to the sink first if it is full
+        void add(const record_type & record);
+
+        /// Adds count records
+        void add(const record_type * const records, const std::size_t count);
+
+        /// Writes the current message to the sink if it holds any records
+        void flush();
+
+        /// Sends the template in the next message
+        void refresh_template() noexcept;
+
+        /// Returns the sequence number of the next message
+        uint32_t sequence_number() const noexcept;
+
+        /// Returns the number of records in the current message
+        std::size_t buffered() const noexcept;
+
+        private:
+
+        void begin_message() noexcept;
+
+        Sink * sink_;
+        std::vector<uint8_t> buffer_;
+        uint32_t observation_domain_;
+        std::size_t template_refresh_;
+
+        /// The number of data records sent, modulo 2^32
+        uint32_t sequence_number_ = 0;
+
+        /// The number of messages sent since the last template
+        std::size_t messages_since_template_ = 0;
+        bool template_pending_ = true;
+
+        /// The offset of the data set header in the current message
+        std::size_t data_set_offset_ = 0;
+        std::size_t records_ = 0;
+        std::size_t max_records_ = 0;
+    };
+
+    template <class Template, class Sink>
+    ipfix_encoder<Template, Sink>::ipfix_encoder(Sink & sink,
+                                                 const uint32_t observation_domain,
+                                                 const std::size_t max_message_size,
+                                                 const std::size_t template_refresh):
+        sink_(&sink),
+        observation_domain_(observation_domain),
+        template_refresh_(template_refresh)
+    {
+        constexpr std::size_t min_size = ipfix_message_header_size + Template::template_set_size +
+                                         ipfix_set_header_size + Template::record_size;
+        if (max_message_size < min_size || max_message_size > 0xffff)
+        {
+            throw ndgpp_error(std::invalid_argument, "ipfix_encoder max_message_size can not hold a record");
+        }
+
+        this->buffer_.resize(max_message_size);
+    }
+
+    template <class Template, class Sink>
+    inline void ipfix_encoder<Template, Sink>::add(const record_type & record)
+    {
+        if (this->records_ == 0)
+        {
+            this->begin_message();
+        }
+
+        const std::size_t offset = this->data_set_offset_ + ipfix_set_header_size + this->records_ * Template::record_size;
+        Template::codec_type::encode(this->buffer_.data() + offset, record);
+        ++this->records_;
+
+        if (this->records_ == this->max_records_)
+        {
+            this->flush();
+        }
+    }
+
+    template <class Template, class Sink>
+    void ipfix_encoder<Template, Sink>::add(const record_type * const records, const std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            this->add(records[i]);
+        }
+    }
+
+    template <class Template, class Sink>
+    void ipfix_encoder<Template, Sink>::flush()
+    {
+        if (this->records_ == 0)
+        {
+            return;
+        }
+
+        using u16 = ndgpp::network_byte_order<uint16_t>;
+        using u32 = ndgpp::network_byte_order<uint32_t>;
+
+        const std::size_t set_size = ipfix_set_header_size + this->records_ * Template::record_size;
+        const std::size_t message_size = this->data_set_offset_ + set_size;
+
+        ndgpp::buffer_writer header {this->buffer_.data(), ipfix_message_header_size};
+        header.put(ndgpp::unchecked, u16 {ipfix_version});
+        header.put(ndgpp::unchecked, u16 {static_cast<uint16_t>(message_size)});
+        header.put(ndgpp::unchecked, u32 {static_cast<uint32_t>(std::time(nullptr))});
+        header.put(ndgpp::unchecked, u32 {this->sequence_number_});
+        header.put(ndgpp::unchecked, u32 {this->observation_domain_});
+
+        ndgpp::buffer_writer set_header {this->buffer_.data() + this->data_set_offset_, ipfix_set_header_size};
+        set_header.put(ndgpp::unchecked, u16 {Template::id});
+        set_header.put(ndgpp::unchecked, u16 {static_cast<uint16_t>(set_size)});
+
+        this->sink_->write(this->buffer_.data(), message_size);
+
+        this->sequence_number_ += static_cast<uint32_t>(this->records_);
+        this->records_ = 0;
+        ++this->messages_since_template_;
+    }
+
+    template <class Template, class Sink>
+    inline void ipfix_encoder<Template, Sink>::refresh_template() noexcept
+    {
+        this->template_pending_ = true;
+    }
+
+    template <class Template, class Sink>
+    inline uint32_t ipfix_encoder<Template, Sink>::sequence_number() const noexcept
+    {
+        return this->sequence_number_;
+    }
+
+    template <class Template, class Sink>
+    inline std::size_t ipfix_encoder<Template, Sink>::buffered() const noexcept
+    {
+        return this->records_;
+    }
+
+    template <class Template, class Sink>
+    void ipfix_encoder<Template, Sink>::begin_message() noexcept
+    {
+        if (this->template_refresh_ != 0 && this->messages_since_template_ >= this->template_refresh_)
+        {
+            this->template_pending_ = true;
+        }
+
+        this->data_set_offset_ = ipfix_message_header_size;
+        if (this->template_pending_)
+        {
+            Template::write_template_set(this->buffer_.data() + this->data_set_offset_);
+            this->data_set_offset_ += Template::template_set_size;
+            this->template_pending_ = false;
+            this->messages_since_template_ = 0;
+        }
+
+        this->max_records_ = (this->buffer_.size() - this->data_set_offset_ - ipfix_set_header_size) / Template::record_size;
+    }
+}}
+
+#endif
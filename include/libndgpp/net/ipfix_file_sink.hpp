@@ -0,0 +1,55 @@
+#ifndef LIBNDGPP_NET_IPFIX_FILE_SINK_HPP
+#define LIBNDGPP_NET_IPFIX_FILE_SINK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <string>
+
+namespace ndgpp {
+namespace net {
+
+    /** Writes IPFIX messages to a file
+     *
+     *  The messages are written back to back, which is the IPFIX
+     *  file format described in RFC 5655.
+     */
+    class ipfix_file_sink
+    {
+        public:
+
+        /** Creates or truncates the file at path
+         *
+         *  @throw ndgpp::error<std::system_error> if the file can not be opened
+         */
+        explicit
+        ipfix_file_sink(const std::string & path);
+
+        ipfix_file_sink(const ipfix_file_sink &) = delete;
+        ipfix_file_sink(ipfix_file_sink &&) = delete;
+
+        ipfix_file_sink & operator = (const ipfix_file_sink &) = delete;
+        ipfix_file_sink & operator = (ipfix_file_sink &&) = delete;
+
+        ~ipfix_file_sink() noexcept;
+
+        /** Writes a message to the file
+         *
+         *  @throw ndgpp::error<std::system_error> if the write fails
+         */
+        void write(uint8_t const * const data, const std::size_t size);
+
+        /** Flushes the written messages to the file
+         *
+         *  @throw ndgpp::error<std::system_error> if the flush fails
+         */
+        void flush();
+
+        private:
+
+        std::FILE * file_;
+    };
+}}
+
+#endif
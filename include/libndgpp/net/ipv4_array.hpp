@@ -2,18 +2,46 @@
 #define LIBNDGPP_NET_IPV4_ARRAY_HPP
 
 
+#include <cstddef>
 #include <cstdint>
 
 #include <array>
 #include <string>
 
+#include <libndgpp/to_chars_result.hpp>
+
+#include <libndgpp/net/ipv4_parse_result.hpp>
+
 namespace ndgpp {
 namespace net {
 
     using ipv4_array = std::array<uint8_t, 4>;
 
+    /// The maximum number of characters in a dotted quad address
+    constexpr std::size_t ipv4_max_chars = 15;
+
     std::string to_string(const ipv4_array value);
 
+    /** Writes the dotted quad form of an address to [first, last)
+     *
+     *  The octets' text comes from a 256 entry table, so nothing is
+     *  allocated and no formatted output functions are called.  The
+     *  output is not null terminated.
+     */
+    ndgpp::to_chars_result to_chars(char * const first, char * const last, const ipv4_array value) noexcept;
+
+    /** Writes the dotted quad form of count addresses to [first, last)
+     *
+     *  Each address is followed by separator, i.e. one address per
+     *  line.  If the addresses do not all fit, the buffer holds the
+     *  addresses that fit.
+     */
+    ndgpp::to_chars_result to_chars(char * const first,
+                                    char * const last,
+                                    ipv4_array const * const values,
+                                    const std::size_t count,
+                                    const char separator = '\n') noexcept;
+
     inline constexpr uint32_t to_uint32(const ipv4_array value)
     {
         return (static_cast<uint32_t>(value[0]) << 24 |
@@ -24,6 +52,22 @@ namespace net {
 
     ipv4_array make_ipv4_array(const std::string & value);
 
+    /** Parses a dotted quad address from the characters in [first, last)
+     *
+     *  Each octet is one to three decimal digits with a value no
+     *  greater than 255.  Parsing stops at the first character after
+     *  the fourth octet that is not a digit, which is returned by the
+     *  result's unparsed member, so the address can be followed by
+     *  other text, i.e. a colon and a port.
+     *
+     *  The address is located with a single 16 byte vector load when
+     *  SSE2 is available.
+     *
+     *  @param first The first character of the address
+     *  @param last One past the last character that may be read
+     */
+    ndgpp::net::ipv4_parse_result parse_ipv4_array(char const * const first, char const * const last) noexcept;
+
     inline constexpr ipv4_array make_ipv4_array(const uint32_t value) noexcept
     {
         return ndgpp::net::ipv4_array {static_cast<uint8_t>((value & 0xff000000) >> 24),
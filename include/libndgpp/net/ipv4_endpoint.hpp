@@ -0,0 +1,257 @@
+#ifndef LIBNDGPP_NET_IPV4_ENDPOINT_HPP
+#define LIBNDGPP_NET_IPV4_ENDPOINT_HPP
+
+#include <netinet/in.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include <libndgpp/detail/hash_mix.hpp>
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/port.hpp>
+#include <libndgpp/to_chars_result.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /** An IPv4 address and port, i.e. 192.0.2.1:8080
+     *
+     *  The address and port are packed into one 64 bit integer, with
+     *  the address in bits 16 through 47 and the port in bits 0
+     *  through 15, so an endpoint is passed in a register and
+     *  equality and ordering are single integer comparisons.
+     *  Endpoints are ordered by address and then by port.
+     *
+     *  \code
+     *  const ndgpp::net::ipv4_endpoint endpoint {"192.0.2.1:8080"};
+     *  const sockaddr_in addr = endpoint.to_sockaddr();
+     */
+    class ipv4_endpoint final
+    {
+        public:
+
+        using address_type = ndgpp::net::ipv4_address;
+        using port_type = ndgpp::net::port;
+
+        /// The maximum number of characters in the text form of an endpoint
+        static constexpr std::size_t max_chars = 21;
+
+        /// Constructs the endpoint 0.0.0.0:0
+        constexpr ipv4_endpoint() noexcept;
+
+        constexpr ipv4_endpoint(const address_type address, const port_type port) noexcept;
+
+        /** Constructs an endpoint from a string
+         *
+         *  @param value A dotted quad address, a colon and a decimal port
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if the whole string is not an endpoint
+         */
+        explicit
+        ipv4_endpoint(const std::string & value);
+
+        /** Constructs an endpoint from a socket address
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if the address family is not AF_INET
+         */
+        explicit
+        ipv4_endpoint(const sockaddr_in & address);
+
+        constexpr address_type address() const noexcept;
+
+        port_type port() const noexcept;
+
+        /// Returns the packed address and port
+        constexpr uint64_t to_uint64() const noexcept;
+
+        /// Returns the endpoint as an AF_INET socket address
+        sockaddr_in to_sockaddr() const noexcept;
+
+        /// Assigns the endpoint to a socket address, leaving its other members alone
+        void to_sockaddr(sockaddr_in & address) const noexcept;
+
+        /// Returns the endpoint as a string, i.e. 192.0.2.1:8080
+        std::string to_string() const;
+
+        private:
+
+        uint64_t value_ = 0;
+    };
+
+    /// The reasons an endpoint fails to parse
+    enum class ipv4_endpoint_parse_errc
+    {
+        none,
+
+        /// The address is not a valid dotted quad
+        invalid_address,
+
+        /// The address is not followed by a colon
+        expected_colon,
+
+        /// The colon is not followed by a digit
+        expected_digit,
+
+        /// The port is greater than 65535
+        port_out_of_range,
+    };
+
+    /// Represents the result of parsing an endpoint
+    class ipv4_endpoint_parse_result final
+    {
+        public:
+
+        using value_type = ndgpp::net::ipv4_endpoint;
+
+        ipv4_endpoint_parse_result(const value_type value, char const * const unparsed) noexcept;
+        ipv4_endpoint_parse_result(const ipv4_endpoint_parse_errc error, char const * const unparsed) noexcept;
+
+        explicit operator bool() const noexcept;
+
+        /// Returns the reason the parse failed, or ipv4_endpoint_parse_errc::none
+        ipv4_endpoint_parse_errc error() const noexcept;
+
+        value_type value() const;
+
+        /** Returns the first character that was not parsed
+         *
+         *  If an error occurred, this is the character the error was
+         *  detected at.
+         */
+        char const * unparsed() const noexcept;
+
+        private:
+
+        value_type value_;
+        ipv4_endpoint_parse_errc error_;
+        char const * unparsed_;
+    };
+
+    /** Parses an endpoint from the characters in [first, last)
+     *
+     *  The endpoint is a dotted quad address, a colon, and a port of
+     *  one to five decimal digits.  The characters are read once, and
+     *  parsing stops at the first character after the port that is
+     *  not a digit.
+     *
+     *  @param first The first character of the endpoint
+     *  @param last One past the last character that may be read
+     */
+    ipv4_endpoint_parse_result parse_ipv4_endpoint(char const * const first, char const * const last) noexcept;
+
+    /// Writes the text form of an endpoint to [first, last), the output is not null terminated
+    ndgpp::to_chars_result to_chars(char * const first, char * const last, const ipv4_endpoint endpoint) noexcept;
+
+    std::ostream & operator <<(std::ostream & stream, const ipv4_endpoint endpoint);
+
+    inline constexpr ipv4_endpoint::ipv4_endpoint() noexcept = default;
+
+    inline constexpr ipv4_endpoint::ipv4_endpoint(const address_type address, const port_type port) noexcept:
+        value_ {uint64_t {address.to_uint32()} << 16 | port.value()}
+    {}
+
+    inline constexpr ipv4_endpoint::address_type ipv4_endpoint::address() const noexcept
+    {
+        return address_type {static_cast<uint32_t>(this->value_ >> 16)};
+    }
+
+    inline ipv4_endpoint::port_type ipv4_endpoint::port() const noexcept
+    {
+        return port_type {static_cast<uint16_t>(this->value_)};
+    }
+
+    inline constexpr uint64_t ipv4_endpoint::to_uint64() const noexcept
+    {
+        return this->value_;
+    }
+
+    inline ipv4_endpoint_parse_result::ipv4_endpoint_parse_result(const value_type value, char const * const unparsed) noexcept:
+        value_(value),
+        error_(ipv4_endpoint_parse_errc::none),
+        unparsed_(unparsed)
+    {}
+
+    inline ipv4_endpoint_parse_result::ipv4_endpoint_parse_result(const ipv4_endpoint_parse_errc error, char const * const unparsed) noexcept:
+        error_(error),
+        unparsed_(unparsed)
+    {}
+
+    inline ipv4_endpoint_parse_result::operator bool() const noexcept
+    {
+        return this->error_ == ipv4_endpoint_parse_errc::none;
+    }
+
+    inline ipv4_endpoint_parse_errc ipv4_endpoint_parse_result::error() const noexcept
+    {
+        return this->error_;
+    }
+
+    inline ipv4_endpoint_parse_result::value_type ipv4_endpoint_parse_result::value() const
+    {
+        if (!(*this))
+        {
+            throw ndgpp_error(std::logic_error,
+                              "ipv4_endpoint_parse_result value not set");
+        }
+
+        return this->value_;
+    }
+
+    inline char const * ipv4_endpoint_parse_result::unparsed() const noexcept
+    {
+        return this->unparsed_;
+    }
+
+    inline constexpr bool operator ==(const ipv4_endpoint lhs, const ipv4_endpoint rhs) noexcept
+    {
+        return lhs.to_uint64() == rhs.to_uint64();
+    }
+
+    inline constexpr bool operator !=(const ipv4_endpoint lhs, const ipv4_endpoint rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline constexpr bool operator <(const ipv4_endpoint lhs, const ipv4_endpoint rhs) noexcept
+    {
+        return lhs.to_uint64() < rhs.to_uint64();
+    }
+
+    inline constexpr bool operator >(const ipv4_endpoint lhs, const ipv4_endpoint rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    inline constexpr bool operator <=(const ipv4_endpoint lhs, const ipv4_endpoint rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    inline constexpr bool operator >=(const ipv4_endpoint lhs, const ipv4_endpoint rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+}}
+
+namespace std
+{
+    template <>
+    struct hash<ndgpp::net::ipv4_endpoint> final
+    {
+        using argument_type = ndgpp::net::ipv4_endpoint;
+        using result_type = std::size_t;
+
+        result_type operator() (const argument_type endpoint) const noexcept
+        {
+            return static_cast<result_type>(ndgpp::detail::hash_mix(endpoint.to_uint64()));
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef LIBNDGPP_NET_IPV4_EXTRACT_HPP
+#define LIBNDGPP_NET_IPV4_EXTRACT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/ipv4_array.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /// Represents the result of extracting addresses from text
+    struct ipv4_extract_result
+    {
+        /// The number of addresses written to the output
+        std::size_t count;
+
+        /** The first character that was not scanned
+         *
+         *  This is the end of the text unless the output filled up,
+         *  in which case extraction can be resumed from here.
+         */
+        char const * unparsed;
+    };
+
+    /** Writes every dotted quad address in [first, last) to out
+     *
+     *  An address is a run of digits and periods that
+     *  ndgpp::net::parse_ipv4_array parses completely, optionally
+     *  followed by one period that ends a sentence.  Longer runs, such
+     *  as the version string 1.2.3.4.5, are skipped whole, so none
+     *  of their suffixes are reported.
+     *
+     *  The runs are located 16 characters at a time with SSE2
+     *  character class masks, and are parsed in batches.
+     *
+     *  @param first The first character of the text
+     *  @param last One past the last character of the text
+     *  @param out The array the addresses are written to
+     *  @param capacity The number of elements in out
+     */
+    ipv4_extract_result extract_ipv4_addresses(char const * const first,
+                                               char const * const last,
+                                               ndgpp::net::ipv4_array * const out,
+                                               const std::size_t capacity) noexcept;
+
+    /// Writes every dotted quad address in [first, last) to out as its unsigned 32 bit value
+    ipv4_extract_result extract_ipv4_addresses(char const * const first,
+                                               char const * const last,
+                                               uint32_t * const out,
+                                               const std::size_t capacity) noexcept;
+
+    /// Writes every dotted quad address in [first, last) to out
+    ipv4_extract_result extract_ipv4_addresses(char const * const first,
+                                               char const * const last,
+                                               ndgpp::net::ipv4_address * const out,
+                                               const std::size_t capacity) noexcept;
+}}
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef LIBNDGPP_NET_IPV4_LPM_TABLE_HPP
+#define LIBNDGPP_NET_IPV4_LPM_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <map>
+#include <vector>
+
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/ipv4_network.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /** Maps IPv4 prefixes to small integer values with longest prefix match lookups
+     *
+     *  The table uses the DIR-24-8 layout.  A first level table has
+     *  an entry for every /24, and prefixes longer than 24 bits are
+     *  stored in 256 entry second level groups.  A lookup is one
+     *  memory access, or two when the address is covered by a prefix
+     *  longer than 24 bits.
+     *
+     *  The first level table is 64 MiB, and each second level group
+     *  is 1 KiB.
+     *
+     *  \code
+     *  ndgpp::net::ipv4_lpm_table table;
+     *  table.insert(ndgpp::net::ipv4_network {"10.0.0.0/8"}, 1);
+     *  table.insert(ndgpp::net::ipv4_network {"10.1.2.128/25"}, 2);
+     *
+     *  const uint32_t tenant = table.lookup(addr);
+     *  if (tenant != ndgpp::net::ipv4_lpm_table::no_match)
+     *
+     *  Lookups do not modify the table, so concurrent lookups are
+     *  safe as long as nothing is inserted or erased at the same time.
+     */
+    class ipv4_lpm_table
+    {
+        public:
+
+        /// The value returned for an address not covered by any prefix
+        static constexpr uint32_t no_match = 0xffffffff;
+
+        /// The largest value that can be stored
+        static constexpr uint32_t max_value = 0x00ffffff;
+
+        ipv4_lpm_table();
+
+        ipv4_lpm_table(const ipv4_lpm_table &) = delete;
+        ipv4_lpm_table & operator = (const ipv4_lpm_table &) = delete;
+
+        ipv4_lpm_table(ipv4_lpm_table &&) noexcept;
+        ipv4_lpm_table & operator = (ipv4_lpm_table &&) noexcept;
+
+        ~ipv4_lpm_table();
+
+        /** Maps a prefix to value, replacing the prefix's current value
+         *
+         *  @throw ndgpp::error<std::out_of_range> if value is greater than max_value
+         */
+        void insert(const ndgpp::net::ipv4_network network, const uint32_t value);
+
+        /** Removes a prefix
+         *
+         *  Addresses the prefix covered are matched by the next
+         *  longest prefix that covers them.
+         *
+         *  @return true if the prefix was in the table
+         */
+        bool erase(const ndgpp::net::ipv4_network network);
+
+        /// Removes every prefix
+        void clear();
+
+        /// Returns the number of prefixes in the table
+        std::size_t size() const noexcept;
+
+        /// Returns the value of the longest prefix that contains address, or no_match
+        uint32_t lookup(const uint32_t address) const noexcept;
+
+        /// Returns the value of the longest prefix that contains address, or no_match
+        uint32_t lookup(const ndgpp::net::ipv4_address address) const noexcept;
+
+        /** Looks up count addresses
+         *
+         *  The first level entries of later addresses are prefetched
+         *  while earlier addresses are looked up, so the memory
+         *  latency of the lookups overlaps.
+         *
+         *  @param addresses The addresses to look up
+         *  @param count The number of addresses
+         *  @param values The value of each address, or no_match
+         */
+        void lookup(uint32_t const * const addresses, const std::size_t count, uint32_t * const values) const noexcept;
+
+        /// Looks up count addresses
+        void lookup(ndgpp::net::ipv4_address const * const addresses, const std::size_t count, uint32_t * const values) const noexcept;
+
+        private:
+
+        /* An entry is laid out like so:
+         *
+         *   bit 31      The entry is valid
+         *   bit 30      The entry refers to a second level group
+         *   bits 24-29  The prefix length of the entry's prefix
+         *   bits 0-23   The value, or the index of the second level group
+         */
+        static constexpr uint32_t valid_flag = 0x80000000;
+        static constexpr uint32_t group_flag = 0x40000000;
+        static constexpr uint32_t value_mask = 0x00ffffff;
+        static constexpr unsigned int depth_shift = 24;
+
+        static constexpr uint32_t make_entry(const uint32_t value, const unsigned int depth) noexcept;
+        static constexpr unsigned int entry_depth(const uint32_t entry) noexcept;
+
+        /// Returns the value of a first level entry for address, following it to the second level if needed
+        uint32_t resolve(uint32_t entry, const uint32_t address) const noexcept;
+
+        /** Assigns the entries in [first, last) of entries that are
+         *  not covered by a prefix longer than depth
+         */
+        void fill(uint32_t * const entries, const std::size_t first, const std::size_t last, const uint32_t entry, const unsigned int depth) noexcept;
+
+        /** Replaces the entries in [first, last) that belong to a prefix of length depth
+         *
+         *  Second level groups referenced by first level entries are
+         *  updated as well.
+         */
+        void replace(uint32_t * const entries,
+                     const std::size_t first,
+                     const std::size_t last,
+                     const unsigned int depth,
+                     const uint32_t replacement,
+                     const bool first_level) noexcept;
+
+        uint32_t allocate_group(const uint32_t entry);
+
+        /// Frees the group referenced by the first level entry at index if every entry in it is the same
+        void collapse_group(const uint32_t index) noexcept;
+
+        std::vector<uint32_t> first_level_;
+        std::vector<uint32_t> second_level_;
+        std::vector<uint32_t> free_groups_;
+        std::map<ndgpp::net::ipv4_network, uint32_t> prefixes_;
+    };
+
+    inline constexpr uint32_t ipv4_lpm_table::make_entry(const uint32_t value, const unsigned int depth) noexcept
+    {
+        return valid_flag | static_cast<uint32_t>(depth) << depth_shift | value;
+    }
+
+    inline constexpr unsigned int ipv4_lpm_table::entry_depth(const uint32_t entry) noexcept
+    {
+        return (entry >> depth_shift) & 0x3f;
+    }
+
+    inline uint32_t ipv4_lpm_table::resolve(uint32_t entry, const uint32_t address) const noexcept
+    {
+        if (entry & group_flag)
+        {
+            entry = this->second_level_[(entry & value_mask) << 8 | (address & 0xff)];
+        }
+
+        return (entry & valid_flag) ? (entry & value_mask) : no_match;
+    }
+
+    inline uint32_t ipv4_lpm_table::lookup(const uint32_t address) const noexcept
+    {
+        return this->resolve(this->first_level_[address >> 8], address);
+    }
+
+    inline uint32_t ipv4_lpm_table::lookup(const ndgpp::net::ipv4_address address) const noexcept
+    {
+        return this->lookup(address.to_uint32());
+    }
+}}
+
+#endif
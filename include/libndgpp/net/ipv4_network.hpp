@@ -0,0 +1,277 @@
+#ifndef LIBNDGPP_NET_IPV4_NETWORK_HPP
+#define LIBNDGPP_NET_IPV4_NETWORK_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include <libndgpp/bounded_integer.hpp>
+#include <libndgpp/detail/hash_mix.hpp>
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/to_chars_result.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    namespace detail
+    {
+        struct ipv4_prefix_length_tag;
+    }
+
+    /// The number of leading bits of an IPv4 network prefix
+    using ipv4_prefix_length = ndgpp::bounded_integer<uint8_t, 0, 32, ndgpp::net::detail::ipv4_prefix_length_tag>;
+
+    /// Returns the network mask of a prefix length in host byte order
+    inline constexpr uint32_t ipv4_prefix_mask(const ipv4_prefix_length prefix_length) noexcept
+    {
+        // Shifting a 64 bit value by up to 32 bits is defined, and
+        // the low half of the result is zero for a zero length prefix
+        return static_cast<uint32_t>(~uint64_t {0} << (32 - prefix_length.value()));
+    }
+
+    /** An IPv4 network given by an address prefix, i.e. 192.168.0.0/16
+     *
+     *  The bits of the network address after the prefix are always
+     *  zero, so networks that cover the same addresses compare
+     *  equal.  Membership tests are a mask and a compare:
+     *
+     *  \code
+     *  const ndgpp::net::ipv4_network net {"10.0.0.0/8"};
+     *  if (net.contains(addr))
+     */
+    class ipv4_network final
+    {
+        public:
+
+        using address_type = ndgpp::net::ipv4_address;
+        using prefix_length_type = ndgpp::net::ipv4_prefix_length;
+
+        /// The maximum number of characters in the a.b.c.d/nn form of a network
+        static constexpr std::size_t max_chars = 18;
+
+        /// Constructs the network 0.0.0.0/0, which contains every address
+        constexpr ipv4_network() noexcept;
+
+        /** Constructs a network from an address and a prefix length
+         *
+         *  The address bits after the prefix are cleared.
+         */
+        constexpr ipv4_network(const address_type address, const prefix_length_type prefix_length) noexcept;
+
+        /** Constructs a network from a string of the form a.b.c.d/nn
+         *
+         *  The address bits after the prefix are cleared.
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if the string does
+         *         not have a prefix length, or the address is invalid
+         *  @throw ndgpp::error<ndgpp::bounded_integer_error> derived
+         *         errors if the prefix length is invalid
+         */
+        explicit
+        ipv4_network(const std::string & value);
+
+        /// Returns the first address of the network
+        constexpr address_type network() const noexcept;
+
+        constexpr prefix_length_type prefix_length() const noexcept;
+
+        /// Returns the network mask in host byte order
+        constexpr uint32_t mask() const noexcept;
+
+        /// Returns the network mask as an address, i.e. 255.255.0.0
+        constexpr address_type netmask() const noexcept;
+
+        /// Returns the last address of the network
+        constexpr address_type broadcast() const noexcept;
+
+        /// Returns the number of addresses in the network
+        constexpr uint64_t size() const noexcept;
+
+        /// Returns true if the address is in the network
+        constexpr bool contains(const address_type address) const noexcept;
+
+        /// Returns true if every address of other is in the network
+        constexpr bool contains(const ipv4_network other) const noexcept;
+
+        /** Returns the network with a shorter prefix that contains this one
+         *
+         *  @throw ndgpp::error<std::out_of_range> if prefix_length is
+         *         longer than this network's prefix length
+         */
+        ipv4_network supernet(const prefix_length_type prefix_length) const;
+
+        /** Returns the network with a one bit shorter prefix
+         *
+         *  @throw ndgpp::error<std::out_of_range> if the prefix length is zero
+         */
+        ipv4_network supernet() const;
+
+        /// Returns the number of subnets with the specified prefix length, or zero if it is shorter than this one
+        constexpr uint64_t subnet_count(const prefix_length_type prefix_length) const noexcept;
+
+        /** Returns a subnet with a longer prefix
+         *
+         *  @param prefix_length The subnet's prefix length
+         *  @param index The index of the subnet, starting at the first address
+         *
+         *  @throw ndgpp::error<std::out_of_range> if prefix_length is
+         *         shorter than this network's prefix length, or index is
+         *         not less than subnet_count(prefix_length)
+         */
+        ipv4_network subnet(const prefix_length_type prefix_length, const uint32_t index = 0) const;
+
+        /// Returns the a.b.c.d/nn form of the network
+        std::string to_string() const;
+
+        private:
+
+        address_type network_;
+        prefix_length_type prefix_length_;
+    };
+
+    /// Writes the a.b.c.d/nn form of a network to [first, last)
+    ndgpp::to_chars_result to_chars(char * const first, char * const last, const ipv4_network network) noexcept;
+
+    inline constexpr ipv4_network::ipv4_network() noexcept = default;
+
+    inline constexpr ipv4_network::ipv4_network(const address_type address, const prefix_length_type prefix_length) noexcept:
+        network_ {address.to_uint32() & ndgpp::net::ipv4_prefix_mask(prefix_length)},
+        prefix_length_ {prefix_length}
+    {}
+
+    inline constexpr ipv4_network::address_type ipv4_network::network() const noexcept
+    {
+        return this->network_;
+    }
+
+    inline constexpr ipv4_network::prefix_length_type ipv4_network::prefix_length() const noexcept
+    {
+        return this->prefix_length_;
+    }
+
+    inline constexpr uint32_t ipv4_network::mask() const noexcept
+    {
+        return ndgpp::net::ipv4_prefix_mask(this->prefix_length_);
+    }
+
+    inline constexpr ipv4_network::address_type ipv4_network::netmask() const noexcept
+    {
+        return address_type {this->mask()};
+    }
+
+    inline constexpr ipv4_network::address_type ipv4_network::broadcast() const noexcept
+    {
+        return address_type {this->network_.to_uint32() | ~this->mask()};
+    }
+
+    inline constexpr uint64_t ipv4_network::size() const noexcept
+    {
+        return uint64_t {1} << (32 - this->prefix_length_.value());
+    }
+
+    inline constexpr bool ipv4_network::contains(const address_type address) const noexcept
+    {
+        return (address.to_uint32() & this->mask()) == this->network_.to_uint32();
+    }
+
+    inline constexpr bool ipv4_network::contains(const ipv4_network other) const noexcept
+    {
+        return (other.prefix_length_.value() >= this->prefix_length_.value()) & this->contains(other.network_);
+    }
+
+    inline ipv4_network ipv4_network::supernet(const prefix_length_type prefix_length) const
+    {
+        if (prefix_length > this->prefix_length_)
+        {
+            throw ndgpp_error(std::out_of_range, "supernet prefix length is longer than the network's prefix length");
+        }
+
+        return ipv4_network {this->network_, prefix_length};
+    }
+
+    inline ipv4_network ipv4_network::supernet() const
+    {
+        if (this->prefix_length_.value() == 0)
+        {
+            throw ndgpp_error(std::out_of_range, "a network with a zero length prefix has no supernet");
+        }
+
+        return ipv4_network {this->network_, prefix_length_type {this->prefix_length_.value() - 1}};
+    }
+
+    inline constexpr uint64_t ipv4_network::subnet_count(const prefix_length_type prefix_length) const noexcept
+    {
+        return prefix_length.value() < this->prefix_length_.value() ?
+            0 :
+            uint64_t {1} << (prefix_length.value() - this->prefix_length_.value());
+    }
+
+    inline ipv4_network ipv4_network::subnet(const prefix_length_type prefix_length, const uint32_t index) const
+    {
+        if (index >= this->subnet_count(prefix_length))
+        {
+            throw ndgpp_error(std::out_of_range, "subnet is not in the network");
+        }
+
+        // The index is shifted by the subnet's size, and a /0 subnet has index zero
+        const uint64_t offset = uint64_t {index} << (32 - prefix_length.value());
+        return ipv4_network {address_type {static_cast<uint32_t>(this->network_.to_uint32() + offset)}, prefix_length};
+    }
+
+    inline bool operator ==(const ipv4_network lhs, const ipv4_network rhs) noexcept
+    {
+        return lhs.network() == rhs.network() && lhs.prefix_length() == rhs.prefix_length();
+    }
+
+    inline bool operator !=(const ipv4_network lhs, const ipv4_network rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// Orders networks by address, and then by prefix length
+    inline bool operator <(const ipv4_network lhs, const ipv4_network rhs) noexcept
+    {
+        return (static_cast<uint64_t>(lhs.network().to_uint32()) << 8 | lhs.prefix_length().value()) <
+               (static_cast<uint64_t>(rhs.network().to_uint32()) << 8 | rhs.prefix_length().value());
+    }
+
+    inline bool operator >(const ipv4_network lhs, const ipv4_network rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    inline bool operator <=(const ipv4_network lhs, const ipv4_network rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    inline bool operator >=(const ipv4_network lhs, const ipv4_network rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+    std::ostream & operator <<(std::ostream & stream, const ipv4_network network);
+}}
+
+namespace std
+{
+    template <>
+    struct hash<ndgpp::net::ipv4_network> final
+    {
+        using argument_type = ndgpp::net::ipv4_network;
+        using result_type = std::size_t;
+
+        result_type operator() (const argument_type network) const noexcept
+        {
+            return static_cast<result_type>(
+                ndgpp::detail::hash_mix(static_cast<uint64_t>(network.network().to_uint32()) << 8 | network.prefix_length().value()));
+        }
+    };
+}
+
+#endif
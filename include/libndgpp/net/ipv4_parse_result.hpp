@@ -0,0 +1,101 @@
+#ifndef LIBNDGPP_NET_IPV4_PARSE_RESULT_HPP
+#define LIBNDGPP_NET_IPV4_PARSE_RESULT_HPP
+
+#include <cstdint>
+
+#include <array>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /// The reasons a dotted quad address fails to parse
+    enum class ipv4_parse_errc
+    {
+        none,
+
+        /// An octet does not start with a digit
+        expected_digit,
+
+        /// An octet is not followed by a period
+        expected_dot,
+
+        /// An octet has more than three digits
+        octet_too_long,
+
+        /// An octet's value is greater than 255
+        octet_out_of_range,
+    };
+
+    /// Represents the result of parsing a dotted quad address
+    class ipv4_parse_result final
+    {
+        public:
+
+        using value_type = std::array<uint8_t, 4>;
+
+        ipv4_parse_result(const value_type value, char const * const unparsed) noexcept;
+        ipv4_parse_result(const ipv4_parse_errc error, char const * const unparsed) noexcept;
+
+        explicit operator bool() const noexcept;
+
+        /// Returns the reason the parse failed, or ipv4_parse_errc::none
+        ipv4_parse_errc error() const noexcept;
+
+        value_type value() const;
+
+        /** Returns the first character that was not parsed
+         *
+         *  If an error occurred, this is the character the error was
+         *  detected at.
+         */
+        char const * unparsed() const noexcept;
+
+        private:
+
+        value_type value_ = {};
+        ipv4_parse_errc error_;
+        char const * unparsed_;
+    };
+
+    inline ipv4_parse_result::ipv4_parse_result(const value_type value, char const * const unparsed) noexcept:
+        value_(value),
+        error_(ipv4_parse_errc::none),
+        unparsed_(unparsed)
+    {}
+
+    inline ipv4_parse_result::ipv4_parse_result(const ipv4_parse_errc error, char const * const unparsed) noexcept:
+        error_(error),
+        unparsed_(unparsed)
+    {}
+
+    inline ipv4_parse_result::operator bool() const noexcept
+    {
+        return this->error_ == ipv4_parse_errc::none;
+    }
+
+    inline ipv4_parse_errc ipv4_parse_result::error() const noexcept
+    {
+        return this->error_;
+    }
+
+    inline ipv4_parse_result::value_type ipv4_parse_result::value() const
+    {
+        if (!(*this))
+        {
+            throw ndgpp_error(std::logic_error,
+                              "ipv4_parse_result value not set");
+        }
+
+        return this->value_;
+    }
+
+    inline char const * ipv4_parse_result::unparsed() const noexcept
+    {
+        return this->unparsed_;
+    }
+}}
+
+#endif
@@ -0,0 +1,259 @@
+#ifndef LIBNDGPP_NET_IPV4_RANGE_SET_HPP
+#define LIBNDGPP_NET_IPV4_RANGE_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/ipv4_network.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /// An inclusive range of IPv4 addresses in host byte order
+    struct ipv4_range
+    {
+        constexpr ipv4_range() noexcept = default;
+
+        constexpr ipv4_range(const uint32_t first, const uint32_t last) noexcept;
+
+        constexpr ipv4_range(const ndgpp::net::ipv4_address first, const ndgpp::net::ipv4_address last) noexcept;
+
+        /// Constructs a range of a single address
+        explicit
+        constexpr ipv4_range(const ndgpp::net::ipv4_address address) noexcept;
+
+        /// Constructs a range of the addresses in a network
+        explicit
+        constexpr ipv4_range(const ndgpp::net::ipv4_network network) noexcept;
+
+        /// Returns the number of addresses in the range
+        constexpr uint64_t size() const noexcept;
+
+        uint32_t first = 0;
+        uint32_t last = 0;
+    };
+
+    inline constexpr ipv4_range::ipv4_range(const uint32_t first, const uint32_t last) noexcept:
+        first(first),
+        last(last)
+    {}
+
+    inline constexpr ipv4_range::ipv4_range(const ndgpp::net::ipv4_address first, const ndgpp::net::ipv4_address last) noexcept:
+        ipv4_range(first.to_uint32(), last.to_uint32())
+    {}
+
+    inline constexpr ipv4_range::ipv4_range(const ndgpp::net::ipv4_address address) noexcept:
+        ipv4_range(address, address)
+    {}
+
+    inline constexpr ipv4_range::ipv4_range(const ndgpp::net::ipv4_network network) noexcept:
+        ipv4_range(network.network(), network.broadcast())
+    {}
+
+    inline constexpr uint64_t ipv4_range::size() const noexcept
+    {
+        return uint64_t {this->last} - this->first + 1;
+    }
+
+    inline constexpr bool operator ==(const ipv4_range lhs, const ipv4_range rhs) noexcept
+    {
+        return lhs.first == rhs.first && lhs.last == rhs.last;
+    }
+
+    inline constexpr bool operator !=(const ipv4_range lhs, const ipv4_range rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /** A set of IPv4 addresses stored as sorted, coalesced ranges
+     *
+     *  The ranges are kept in a flat array sorted by address, and
+     *  overlapping or adjacent ranges are merged when they are
+     *  inserted.  Membership queries search a second copy of the
+     *  ranges laid out in Eytzinger (breadth first) order, so the
+     *  first levels of the search share a few cache lines and the
+     *  next levels can be prefetched.
+     *
+     *  \code
+     *  ndgpp::net::ipv4_range_set deny;
+     *  deny.insert(ndgpp::net::ipv4_network {"10.0.0.0/8"});
+     *  deny.insert(ndgpp::net::ipv4_range {first, last});
+     *
+     *  if (deny.contains(addr))
+     *
+     *  Inserting or erasing a single range is linear in the number of
+     *  ranges, so large sets should be built with the bulk constructor
+     *  or the bulk insert.
+     */
+    class ipv4_range_set
+    {
+        public:
+
+        using value_type = ipv4_range;
+        using const_iterator = std::vector<ipv4_range>::const_iterator;
+
+        ipv4_range_set();
+
+        /** Constructs a set from count ranges in any order
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if a range's first address is greater than its last
+         */
+        ipv4_range_set(ipv4_range const * const ranges, const std::size_t count);
+
+        /** Adds the addresses in range to the set
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if range.first is greater than range.last
+         */
+        void insert(const ipv4_range range);
+
+        void insert(const ndgpp::net::ipv4_network network);
+
+        void insert(const ndgpp::net::ipv4_address address);
+
+        /** Adds the addresses in count ranges to the set
+         *
+         *  The ranges are sorted and merged with the set in one pass.
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if a range's first address is greater than its last
+         */
+        void insert(ipv4_range const * const ranges, const std::size_t count);
+
+        /** Removes the addresses in range from the set
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if range.first is greater than range.last
+         */
+        void erase(const ipv4_range range);
+
+        void erase(const ndgpp::net::ipv4_network network);
+
+        void erase(const ndgpp::net::ipv4_address address);
+
+        /// Removes every range
+        void clear() noexcept;
+
+        /// Returns true if the set contains address
+        bool contains(const uint32_t address) const noexcept;
+
+        /// Returns true if the set contains address
+        bool contains(const ndgpp::net::ipv4_address address) const noexcept;
+
+        /// Returns true if the set contains every address in range
+        bool contains(const ipv4_range range) const noexcept;
+
+        /** Tests count addresses for membership
+         *
+         *  The searches for a group of addresses are interleaved, so
+         *  the cache misses of one search overlap with the others.
+         *
+         *  @param addresses The addresses to test
+         *  @param count The number of addresses
+         *  @param results Assigned true for each address in the set
+         */
+        void contains(uint32_t const * const addresses, const std::size_t count, bool * const results) const noexcept;
+
+        /// Tests count addresses for membership
+        void contains(ndgpp::net::ipv4_address const * const addresses, const std::size_t count, bool * const results) const noexcept;
+
+        /// Returns the sorted, coalesced ranges
+        const std::vector<ipv4_range> & ranges() const noexcept;
+
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        /// Returns the number of ranges
+        std::size_t size() const noexcept;
+
+        bool empty() const noexcept;
+
+        /// Returns the number of addresses in the set
+        uint64_t address_count() const noexcept;
+
+        private:
+
+        friend ipv4_range_set set_union(const ipv4_range_set &, const ipv4_range_set &);
+        friend ipv4_range_set set_intersection(const ipv4_range_set &, const ipv4_range_set &);
+        friend ipv4_range_set set_difference(const ipv4_range_set &, const ipv4_range_set &);
+
+        /// Returns the 1 based Eytzinger index of the first range whose last address is not less than address, or 0
+        std::size_t search(const uint32_t address) const noexcept;
+
+        /// Rebuilds the search layout from the sorted ranges
+        void build_layout();
+
+        std::vector<ipv4_range> ranges_;
+
+        /// The ranges in Eytzinger order, element 0 is unused
+        std::vector<ipv4_range> layout_;
+    };
+
+    /// Returns the addresses in either lhs or rhs in linear time
+    ipv4_range_set set_union(const ipv4_range_set & lhs, const ipv4_range_set & rhs);
+
+    /// Returns the addresses in both lhs and rhs in linear time
+    ipv4_range_set set_intersection(const ipv4_range_set & lhs, const ipv4_range_set & rhs);
+
+    /// Returns the addresses in lhs that are not in rhs in linear time
+    ipv4_range_set set_difference(const ipv4_range_set & lhs, const ipv4_range_set & rhs);
+
+    bool operator ==(const ipv4_range_set & lhs, const ipv4_range_set & rhs) noexcept;
+    bool operator !=(const ipv4_range_set & lhs, const ipv4_range_set & rhs) noexcept;
+
+    inline std::size_t ipv4_range_set::search(const uint32_t address) const noexcept
+    {
+        ipv4_range const * const layout = this->layout_.data();
+        const std::size_t size = this->ranges_.size();
+
+        std::size_t index = 1;
+        while (index <= size)
+        {
+            // Eight ranges share a cache line, so this is the line of
+            // the search's descendants three levels down
+            __builtin_prefetch(layout + index * 8);
+            index = 2 * index + (layout[index].last < address);
+        }
+
+        // Strip the trailing right turns to find where the search last went left
+        return index >> __builtin_ffsll(static_cast<long long>(~index));
+    }
+
+    inline bool ipv4_range_set::contains(const uint32_t address) const noexcept
+    {
+        const std::size_t index = this->search(address);
+        return index != 0 && this->layout_[index].first <= address;
+    }
+
+    inline bool ipv4_range_set::contains(const ndgpp::net::ipv4_address address) const noexcept
+    {
+        return this->contains(address.to_uint32());
+    }
+
+    inline const std::vector<ipv4_range> & ipv4_range_set::ranges() const noexcept
+    {
+        return this->ranges_;
+    }
+
+    inline ipv4_range_set::const_iterator ipv4_range_set::begin() const noexcept
+    {
+        return this->ranges_.begin();
+    }
+
+    inline ipv4_range_set::const_iterator ipv4_range_set::end() const noexcept
+    {
+        return this->ranges_.end();
+    }
+
+    inline std::size_t ipv4_range_set::size() const noexcept
+    {
+        return this->ranges_.size();
+    }
+
+    inline bool ipv4_range_set::empty() const noexcept
+    {
+        return this->ranges_.empty();
+    }
+}}
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef LIBNDGPP_NET_IPV6_ADDRESS_HPP
+#define LIBNDGPP_NET_IPV6_ADDRESS_HPP
+
+#include <libndgpp/net/basic_ipv6_address.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    using ipv6_address = ndgpp::net::basic_ipv6_address<>;
+    extern template class ndgpp::net::basic_ipv6_address<>;
+}}
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef LIBNDGPP_NET_IPV6_ARRAY_HPP
+#define LIBNDGPP_NET_IPV6_ARRAY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <string>
+
+#include <libndgpp/to_chars_result.hpp>
+
+#include <libndgpp/net/ipv6_parse_result.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    using ipv6_array = std::array<uint8_t, 16>;
+
+    /// The maximum number of characters in the canonical form of an IPv6 address
+    constexpr std::size_t ipv6_max_chars = 39;
+
+    std::string to_string(const ipv6_array value);
+
+    /** Writes the canonical form of an address to [first, last)
+     *
+     *  The canonical form is described in RFC 5952.  Groups are
+     *  written in lower case without leading zeros, the longest run
+     *  of two or more zero groups is replaced by ::, the first run
+     *  winning a tie, and IPv4-mapped addresses end in a dotted
+     *  quad, i.e. ::ffff:192.0.2.1.  The output is not null
+     *  terminated.
+     */
+    ndgpp::to_chars_result to_chars(char * const first, char * const last, const ipv6_array value) noexcept;
+
+    /// Returns the most significant 64 bits of an address
+    inline constexpr uint64_t ipv6_high(const ipv6_array value) noexcept
+    {
+        return (static_cast<uint64_t>(value[0]) << 56 |
+                static_cast<uint64_t>(value[1]) << 48 |
+                static_cast<uint64_t>(value[2]) << 40 |
+                static_cast<uint64_t>(value[3]) << 32 |
+                static_cast<uint64_t>(value[4]) << 24 |
+                static_cast<uint64_t>(value[5]) << 16 |
+                static_cast<uint64_t>(value[6]) << 8 |
+                static_cast<uint64_t>(value[7]));
+    }
+
+    /// Returns the least significant 64 bits of an address
+    inline constexpr uint64_t ipv6_low(const ipv6_array value) noexcept
+    {
+        return (static_cast<uint64_t>(value[8]) << 56 |
+                static_cast<uint64_t>(value[9]) << 48 |
+                static_cast<uint64_t>(value[10]) << 40 |
+                static_cast<uint64_t>(value[11]) << 32 |
+                static_cast<uint64_t>(value[12]) << 24 |
+                static_cast<uint64_t>(value[13]) << 16 |
+                static_cast<uint64_t>(value[14]) << 8 |
+                static_cast<uint64_t>(value[15]));
+    }
+
+    /** Constructs an IPv6 array from a string
+     *
+     *  @throw ndgpp::error<std::invalid_argument> if the whole string is not an IPv6 address
+     */
+    ipv6_array make_ipv6_array(const std::string & value);
+
+    /** Parses an IPv6 address from the characters in [first, last)
+     *
+     *  The address is in the text form described in RFC 4291: eight
+     *  groups of one to four hexadecimal digits separated by colons,
+     *  where one run of zero groups may be replaced by ::, and the
+     *  last two groups may be written as a dotted quad.  Parsing
+     *  stops at the first character that cannot continue the
+     *  address, which is returned by the result's unparsed member.
+     *
+     *  The address is parsed in a single pass without allocating.
+     *
+     *  @param first The first character of the address
+     *  @param last One past the last character that may be read
+     */
+    ndgpp::net::ipv6_parse_result parse_ipv6_array(char const * const first, char const * const last) noexcept;
+
+    /// Constructs an IPv6 array from its most and least significant 64 bits
+    inline constexpr ipv6_array make_ipv6_array(const uint64_t high, const uint64_t low) noexcept
+    {
+        return ndgpp::net::ipv6_array {static_cast<uint8_t>(high >> 56),
+                static_cast<uint8_t>(high >> 48),
+                static_cast<uint8_t>(high >> 40),
+                static_cast<uint8_t>(high >> 32),
+                static_cast<uint8_t>(high >> 24),
+                static_cast<uint8_t>(high >> 16),
+                static_cast<uint8_t>(high >> 8),
+                static_cast<uint8_t>(high),
+                static_cast<uint8_t>(low >> 56),
+                static_cast<uint8_t>(low >> 48),
+                static_cast<uint8_t>(low >> 40),
+                static_cast<uint8_t>(low >> 32),
+                static_cast<uint8_t>(low >> 24),
+                static_cast<uint8_t>(low >> 16),
+                static_cast<uint8_t>(low >> 8),
+                static_cast<uint8_t>(low)};
+    }
+}}
+
+#endif
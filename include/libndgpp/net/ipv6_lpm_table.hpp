@@ -0,0 +1,240 @@
+#ifndef LIBNDGPP_NET_IPV6_LPM_TABLE_HPP
+#define LIBNDGPP_NET_IPV6_LPM_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <vector>
+
+#include <libndgpp/bounded_integer.hpp>
+#include <libndgpp/net/ipv6_address.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    namespace detail
+    {
+        struct ipv6_prefix_length_tag;
+    }
+
+    /// The number of leading bits of an IPv6 network prefix
+    using ipv6_prefix_length = ndgpp::bounded_integer<uint8_t, 0, 128, ndgpp::net::detail::ipv6_prefix_length_tag>;
+
+    /** Maps IPv6 prefixes to integer values with longest prefix match lookups
+     *
+     *  The table is a tree bitmap: a multibit trie whose nodes each
+     *  cover six bits of the address.  A node holds a bitmap of the
+     *  prefixes that end inside of it and a bitmap of its children,
+     *  and its children and prefix values are stored contiguously,
+     *  so the position of a child or value is the population count
+     *  of the bits before it.  A node is 24 bytes no matter how many
+     *  children it has, so memory grows with the number of prefixes
+     *  rather than with the trie's fan out.
+     *
+     *  \code
+     *  ndgpp::net::ipv6_lpm_table table;
+     *  table.insert(ndgpp::net::ipv6_address {std::string {"2001:db8::"}}, ndgpp::net::ipv6_prefix_length {32}, 1);
+     *
+     *  const uint32_t rule = table.lookup(addr);
+     *  if (rule != ndgpp::net::ipv6_lpm_table::no_match)
+     *
+     *  Lookups do not modify the table, so concurrent lookups are
+     *  safe as long as nothing is inserted or erased at the same time.
+     */
+    class ipv6_lpm_table
+    {
+        public:
+
+        /// The value returned for an address not covered by any prefix
+        static constexpr uint32_t no_match = 0xffffffff;
+
+        /// The largest value that can be stored
+        static constexpr uint32_t max_value = 0xfffffffe;
+
+        ipv6_lpm_table();
+
+        ipv6_lpm_table(const ipv6_lpm_table &) = delete;
+        ipv6_lpm_table & operator = (const ipv6_lpm_table &) = delete;
+
+        ipv6_lpm_table(ipv6_lpm_table &&) noexcept;
+        ipv6_lpm_table & operator = (ipv6_lpm_table &&) noexcept;
+
+        ~ipv6_lpm_table();
+
+        /** Maps a prefix to value, replacing the prefix's current value
+         *
+         *  The bits of prefix after prefix_length are ignored.
+         *
+         *  @throw ndgpp::error<std::out_of_range> if value is greater than max_value
+         */
+        void insert(const ndgpp::net::ipv6_address prefix,
+                    const ndgpp::net::ipv6_prefix_length prefix_length,
+                    const uint32_t value);
+
+        /** Removes a prefix
+         *
+         *  Nodes left without prefixes or children are freed, and
+         *  their memory is reused by later inserts.
+         *
+         *  @return true if the prefix was in the table
+         */
+        bool erase(const ndgpp::net::ipv6_address prefix, const ndgpp::net::ipv6_prefix_length prefix_length);
+
+        /// Removes every prefix
+        void clear();
+
+        /// Returns the number of prefixes in the table
+        std::size_t size() const noexcept;
+
+        /// Returns the value of the longest prefix that contains address, or no_match
+        uint32_t lookup(const ndgpp::net::ipv6_address address) const noexcept;
+
+        /** Looks up count addresses
+         *
+         *  The trie walks of a group of addresses are interleaved, and
+         *  each walk prefetches its next node, so the memory latency
+         *  of the walks overlaps.
+         *
+         *  @param addresses The addresses to look up
+         *  @param count The number of addresses
+         *  @param values The value of each address, or no_match
+         */
+        void lookup(ndgpp::net::ipv6_address const * const addresses, const std::size_t count, uint32_t * const values) const noexcept;
+
+        private:
+
+        /// The number of address bits covered by a node
+        static constexpr unsigned int stride = 6;
+
+        /// The number of node levels needed to cover a /128
+        static constexpr unsigned int depth_count = 128 / stride + 1;
+
+        /// Indicates that a walk has not matched a prefix yet
+        static constexpr uint32_t no_result = 0xffffffff;
+
+        struct node
+        {
+            /** The prefixes that end in the node
+             *
+             *  A prefix of local length l, where l is less than stride,
+             *  whose local bits are b has the bit (1 << l) | b.
+             */
+            uint64_t internal = 0;
+
+            /// The child nodes, a child's bit is the stride bits that lead to it
+            uint64_t external = 0;
+
+            /// The index of the node's first child in nodes_
+            uint32_t children = 0;
+
+            /// The index of the node's first prefix value in results_
+            uint32_t results = 0;
+        };
+
+        /// Returns the stride bits of address at depth, bits past the address are zero
+        static unsigned int chunk(const uint64_t high, const uint64_t low, const unsigned int depth) noexcept;
+
+        /// Returns the internal bits of every prefix in a node that contains the chunk bits
+        static uint64_t ancestors(const unsigned int bits) noexcept;
+
+        /// Returns the number of bits set in bitmap before bit
+        static unsigned int rank(const uint64_t bitmap, const unsigned int bit) noexcept;
+
+        /// Returns the index in results_ of the longest prefix in n that contains bits, or no_result
+        static uint32_t match(const node & n, const unsigned int bits) noexcept;
+
+        /// Allocates a block of size nodes and returns its index
+        uint32_t allocate_nodes(const std::size_t size);
+
+        /// Allocates a block of size values and returns its index
+        uint32_t allocate_results(const std::size_t size);
+
+        std::vector<node> nodes_;
+        std::vector<uint32_t> results_;
+
+        /// The free blocks of each size, indexed by size
+        std::array<std::vector<uint32_t>, 65> free_nodes_;
+        std::array<std::vector<uint32_t>, 64> free_results_;
+
+        std::size_t size_ = 0;
+    };
+
+    inline unsigned int ipv6_lpm_table::chunk(const uint64_t high, const uint64_t low, const unsigned int depth) noexcept
+    {
+        const unsigned int offset = depth * stride;
+        if (offset + stride <= 64)
+        {
+            return static_cast<unsigned int>(high >> (64 - stride - offset)) & 0x3f;
+        }
+
+        if (offset < 64)
+        {
+            // The chunk straddles the two halves of the address
+            return static_cast<unsigned int>(high << (offset + stride - 64) | low >> (128 - stride - offset)) & 0x3f;
+        }
+
+        const unsigned int low_offset = offset - 64;
+        if (low_offset + stride <= 64)
+        {
+            return static_cast<unsigned int>(low >> (64 - stride - low_offset)) & 0x3f;
+        }
+
+        return static_cast<unsigned int>(low << (low_offset + stride - 64)) & 0x3f;
+    }
+
+    inline uint64_t ipv6_lpm_table::ancestors(const unsigned int bits) noexcept
+    {
+        uint64_t bitmap = 0;
+        for (unsigned int length = 0; length < stride; ++length)
+        {
+            bitmap |= uint64_t {1} << ((1u << length) | (bits >> (stride - length)));
+        }
+
+        return bitmap;
+    }
+
+    inline unsigned int ipv6_lpm_table::rank(const uint64_t bitmap, const unsigned int bit) noexcept
+    {
+        return static_cast<unsigned int>(__builtin_popcountll(bitmap & ((uint64_t {1} << bit) - 1)));
+    }
+
+    inline uint32_t ipv6_lpm_table::match(const node & n, const unsigned int bits) noexcept
+    {
+        const uint64_t matches = n.internal & ancestors(bits);
+        if (matches == 0)
+        {
+            return no_result;
+        }
+
+        // Longer prefixes have higher bits, so the highest bit is the longest match
+        const unsigned int bit = 63 - static_cast<unsigned int>(__builtin_clzll(matches));
+        return n.results + rank(n.internal, bit);
+    }
+
+    inline uint32_t ipv6_lpm_table::lookup(const ndgpp::net::ipv6_address address) const noexcept
+    {
+        const uint64_t high = address.high();
+        const uint64_t low = address.low();
+
+        uint32_t result = no_result;
+        const node * n = &this->nodes_[0];
+        for (unsigned int depth = 0; depth < depth_count; ++depth)
+        {
+            const unsigned int bits = chunk(high, low, depth);
+            const uint32_t node_result = match(*n, bits);
+            result = node_result != no_result ? node_result : result;
+
+            if (!(n->external >> bits & 1))
+            {
+                break;
+            }
+
+            n = &this->nodes_[n->children + rank(n->external, bits)];
+        }
+
+        return result != no_result ? this->results_[result] : no_match;
+    }
+}}
+
+#endif
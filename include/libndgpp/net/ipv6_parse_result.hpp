@@ -0,0 +1,107 @@
+#ifndef LIBNDGPP_NET_IPV6_PARSE_RESULT_HPP
+#define LIBNDGPP_NET_IPV6_PARSE_RESULT_HPP
+
+#include <cstdint>
+
+#include <array>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /// The reasons an IPv6 address fails to parse
+    enum class ipv6_parse_errc
+    {
+        none,
+
+        /// A group does not start with a hexadecimal digit
+        expected_digit,
+
+        /// A group has more than four hexadecimal digits
+        group_too_long,
+
+        /// The address has more than eight groups, or eight groups and a ::
+        too_many_groups,
+
+        /// The address has fewer than eight groups and no ::
+        too_few_groups,
+
+        /// The address has more than one ::
+        multiple_compressions,
+
+        /// The embedded IPv4 address is not a valid dotted quad
+        invalid_ipv4,
+    };
+
+    /// Represents the result of parsing an IPv6 address
+    class ipv6_parse_result final
+    {
+        public:
+
+        using value_type = std::array<uint8_t, 16>;
+
+        ipv6_parse_result(const value_type value, char const * const unparsed) noexcept;
+        ipv6_parse_result(const ipv6_parse_errc error, char const * const unparsed) noexcept;
+
+        explicit operator bool() const noexcept;
+
+        /// Returns the reason the parse failed, or ipv6_parse_errc::none
+        ipv6_parse_errc error() const noexcept;
+
+        value_type value() const;
+
+        /** Returns the first character that was not parsed
+         *
+         *  If an error occurred, this is the character the error was
+         *  detected at.
+         */
+        char const * unparsed() const noexcept;
+
+        private:
+
+        value_type value_ = {};
+        ipv6_parse_errc error_;
+        char const * unparsed_;
+    };
+
+    inline ipv6_parse_result::ipv6_parse_result(const value_type value, char const * const unparsed) noexcept:
+        value_(value),
+        error_(ipv6_parse_errc::none),
+        unparsed_(unparsed)
+    {}
+
+    inline ipv6_parse_result::ipv6_parse_result(const ipv6_parse_errc error, char const * const unparsed) noexcept:
+        error_(error),
+        unparsed_(unparsed)
+    {}
+
+    inline ipv6_parse_result::operator bool() const noexcept
+    {
+        return this->error_ == ipv6_parse_errc::none;
+    }
+
+    inline ipv6_parse_errc ipv6_parse_result::error() const noexcept
+    {
+        return this->error_;
+    }
+
+    inline ipv6_parse_result::value_type ipv6_parse_result::value() const
+    {
+        if (!(*this))
+        {
+            throw ndgpp_error(std::logic_error,
+                              "ipv6_parse_result value not set");
+        }
+
+        return this->value_;
+    }
+
+    inline char const * ipv6_parse_result::unparsed() const noexcept
+    {
+        return this->unparsed_;
+    }
+}}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef LIBNDGPP_NET_MULTICAST_IPV6_ADDRESS_HPP
+#define LIBNDGPP_NET_MULTICAST_IPV6_ADDRESS_HPP
+
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/basic_ipv6_address.hpp>
+#include <libndgpp/net/ipv6_address.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /// An address in ff00::/8
+    using multicast_ipv6_address = ndgpp::net::basic_ipv6_address<0xff00000000000000, 0xffffffffffffffff>;
+    extern template class ndgpp::net::basic_ipv6_address<0xff00000000000000, 0xffffffffffffffff>;
+}}
+
+#endif
@@ -0,0 +1,268 @@
+#ifndef LIBNDGPP_NET_MULTICAST_REGISTRY_HPP
+#define LIBNDGPP_NET_MULTICAST_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+
+#include <libndgpp/detail/hash_mix.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/multicast_ipv4_address.hpp>
+
+namespace ndgpp {
+namespace net {
+
+    /** Maps multicast groups, optionally paired with a source, to subscriber handles
+     *
+     *  A subscription is either any-source, written (*, G), or
+     *  source-specific, written (S, G).  A lookup for (S, G) returns
+     *  the handle of the (S, G) subscription if there is one, and the
+     *  handle of the (*, G) subscription otherwise.
+     *
+     *  \code
+     *  ndgpp::net::multicast_registry registry {4096};
+     *  registry.insert(group, 3);
+     *  registry.insert(source, group, 7);
+     *
+     *  const uint32_t handle = registry.lookup(packet_source, packet_group);
+     *  if (handle != ndgpp::net::multicast_registry::no_subscriber)
+     *
+     *  The subscriptions are stored in a flat open addressing table
+     *  whose capacity is fixed at construction, so lookups never
+     *  allocate.  Each slot is guarded by a sequence counter, which
+     *  makes lookups safe while a single thread inserts and erases
+     *  subscriptions.  Writers must be serialized by the caller.
+     *
+     *  Erased subscriptions leave markers in the table so probes for
+     *  the keys past them still reach those keys.  A marker followed
+     *  by an empty slot is cleared on erase, and an insert rebuilds
+     *  the table once the subscriptions and markers would exceed
+     *  three quarters of the slots, so the probes stay short no
+     *  matter how many subscriptions come and go.  Lookups made
+     *  during a rebuild retry until it finishes.
+     */
+    class multicast_registry
+    {
+        public:
+
+        /// The handle returned when a group has no subscription
+        static constexpr uint32_t no_subscriber = 0xffffffff;
+
+        /** Constructs a registry that can hold up to max_size subscriptions
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if max_size is zero
+         */
+        explicit
+        multicast_registry(const std::size_t max_size);
+
+        multicast_registry(const multicast_registry &) = delete;
+        multicast_registry & operator = (const multicast_registry &) = delete;
+
+        multicast_registry(multicast_registry &&) noexcept;
+        multicast_registry & operator = (multicast_registry &&) noexcept;
+
+        ~multicast_registry();
+
+        /** Subscribes handle to (*, group), replacing the current handle
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if handle is no_subscriber
+         *  @throw ndgpp::error<std::length_error> if the registry is full
+         */
+        void insert(const ndgpp::net::multicast_ipv4_address group, const uint32_t handle);
+
+        /** Subscribes handle to (source, group), replacing the current handle
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if source is
+         *         0.0.0.0, which names (*, group), or handle is no_subscriber
+         *  @throw ndgpp::error<std::length_error> if the registry is full
+         */
+        void insert(const ndgpp::net::ipv4_address source,
+                    const ndgpp::net::multicast_ipv4_address group,
+                    const uint32_t handle);
+
+        /// Removes the (*, group) subscription, returns true if it existed
+        bool erase(const ndgpp::net::multicast_ipv4_address group);
+
+        /** Removes the (source, group) subscription, returns true if it existed
+         *
+         *  @throw ndgpp::error<std::invalid_argument> if source is 0.0.0.0
+         */
+        bool erase(const ndgpp::net::ipv4_address source, const ndgpp::net::multicast_ipv4_address group);
+
+        /// Removes every subscription
+        void clear() noexcept;
+
+        /// Returns the handle subscribed to (*, group), or no_subscriber
+        uint32_t lookup(const ndgpp::net::multicast_ipv4_address group) const noexcept;
+
+        /** Returns the handle subscribed to (source, group) or (*, group), or no_subscriber
+         *
+         *  No (0.0.0.0, group) subscription can exist, so a source of
+         *  0.0.0.0 returns the (*, group) handle.
+         */
+        uint32_t lookup(const ndgpp::net::ipv4_address source, const ndgpp::net::multicast_ipv4_address group) const noexcept;
+
+        /** Looks up the (*, G) subscriptions of count groups
+         *
+         *  The slots of later groups are prefetched while earlier
+         *  groups are looked up.
+         *
+         *  @param groups The destination groups
+         *  @param count The number of groups
+         *  @param handles The handle of each group, or no_subscriber
+         */
+        void lookup(ndgpp::net::multicast_ipv4_address const * const groups,
+                    const std::size_t count,
+                    uint32_t * const handles) const noexcept;
+
+        /** Looks up the subscriptions of count (source, group) pairs
+         *
+         *  @param sources The source of each packet
+         *  @param groups The destination group of each packet
+         *  @param count The number of packets
+         *  @param handles The handle of each packet, or no_subscriber
+         */
+        void lookup(ndgpp::net::ipv4_address const * const sources,
+                    ndgpp::net::multicast_ipv4_address const * const groups,
+                    const std::size_t count,
+                    uint32_t * const handles) const noexcept;
+
+        /// Returns the number of subscriptions
+        std::size_t size() const noexcept;
+
+        /// Returns the largest number of subscriptions the registry can hold
+        std::size_t max_size() const noexcept;
+
+        /// Returns the number of slots in the table
+        std::size_t capacity() const noexcept;
+
+        /// Returns the number of slots holding a subscription or an erased subscription marker
+        std::size_t used_slots() const noexcept;
+
+        private:
+
+        /* A key is the source address in the high 32 bits and the
+         * group address in the low 32 bits, with a source of zero for
+         * (*, G), which is why a source of 0.0.0.0 is rejected for
+         * (S, G).  Group addresses are always multicast, so keys with
+         * a group of zero or one never name a subscription.
+         */
+        static constexpr uint64_t empty_key = 0;
+        static constexpr uint64_t erased_key = 1;
+
+        struct slot
+        {
+            /// Odd while the writer is modifying the slot
+            std::atomic<uint32_t> sequence {0};
+            std::atomic<uint32_t> handle {no_subscriber};
+            std::atomic<uint64_t> key {empty_key};
+        };
+
+        static constexpr uint64_t make_key(const uint32_t source, const uint32_t group) noexcept;
+
+        std::size_t home(const uint64_t key) const noexcept;
+
+        /// Returns the handle of key, or no_subscriber
+        uint32_t find(const uint64_t key) const noexcept;
+
+        /// Probes the table for key without checking for a concurrent rebuild
+        uint32_t probe(const uint64_t key) const noexcept;
+
+        void insert(const uint64_t key, const uint32_t handle);
+
+        bool erase(const uint64_t key);
+
+        /// Reinserts the subscriptions into a table without erased markers
+        void rebuild();
+
+        /// Assigns a slot's key and handle while lookups may be reading it
+        static void store(slot & s, const uint64_t key, const uint32_t handle) noexcept;
+
+        std::unique_ptr<slot[]> slots_;
+        std::size_t mask_;
+        std::size_t max_size_;
+        std::size_t size_ = 0;
+
+        /// The number of slots marked erased
+        std::size_t erased_ = 0;
+
+        /// Odd while the table is being rebuilt
+        std::atomic<uint32_t> generation_ {0};
+    };
+
+    inline constexpr uint64_t multicast_registry::make_key(const uint32_t source, const uint32_t group) noexcept
+    {
+        return uint64_t {source} << 32 | group;
+    }
+
+    inline std::size_t multicast_registry::home(const uint64_t key) const noexcept
+    {
+        return static_cast<std::size_t>(ndgpp::detail::hash_mix(key)) & this->mask_;
+    }
+
+    inline uint32_t multicast_registry::find(const uint64_t key) const noexcept
+    {
+        // A rebuild moves keys between slots, so a probe that overlaps
+        // one may have missed its key
+        uint32_t generation;
+        uint32_t handle;
+        do
+        {
+            generation = this->generation_.load(std::memory_order_acquire);
+            handle = this->probe(key);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((generation & 1) || generation != this->generation_.load(std::memory_order_relaxed));
+
+        return handle;
+    }
+
+    inline uint32_t multicast_registry::probe(const uint64_t key) const noexcept
+    {
+        std::size_t index = this->home(key);
+        for (std::size_t probes = 0; probes <= this->mask_; ++probes)
+        {
+            const slot & s = this->slots_[index];
+
+            uint32_t sequence;
+            uint64_t slot_key;
+            uint32_t handle;
+            do
+            {
+                sequence = s.sequence.load(std::memory_order_acquire);
+                slot_key = s.key.load(std::memory_order_relaxed);
+                handle = s.handle.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+            } while ((sequence & 1) || sequence != s.sequence.load(std::memory_order_relaxed));
+
+            if (slot_key == key)
+            {
+                return handle;
+            }
+
+            if (slot_key == empty_key)
+            {
+                break;
+            }
+
+            index = (index + 1) & this->mask_;
+        }
+
+        return no_subscriber;
+    }
+
+    inline uint32_t multicast_registry::lookup(const ndgpp::net::multicast_ipv4_address group) const noexcept
+    {
+        return this->find(make_key(0, group.to_uint32()));
+    }
+
+    inline uint32_t multicast_registry::lookup(const ndgpp::net::ipv4_address source,
+                                               const ndgpp::net::multicast_ipv4_address group) const noexcept
+    {
+        const uint32_t handle = this->find(make_key(source.to_uint32(), group.to_uint32()));
+        return handle != no_subscriber ? handle : this->lookup(group);
+    }
+}}
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef LIBNDGPP_NETWORK_BITFIELD_HPP
+#define LIBNDGPP_NETWORK_BITFIELD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <limits>
+#include <type_traits>
+
+#include <libndgpp/network_byte_order.hpp>
+#include <libndgpp/unaligned_network_byte_order.hpp>
+
+namespace ndgpp
+{
+    /** Accesses a bitfield packed in a big endian word
+     *
+     *  Bits are numbered the way protocol specifications number
+     *  them: bit zero is the most significant bit of the first byte
+     *  in the word.  For example, the IPv4 header's flags and
+     *  fragment offset fields are described like so:
+     *
+     *  \code
+     *  using flags = ndgpp::network_bitfield<uint16_t, 0, 3>;
+     *  using fragment_offset = ndgpp::network_bitfield<uint16_t, 3, 13>;
+     *
+     *  const uint16_t offset = fragment_offset::load(buf + 6);
+     *  flags::store(buf + 6, 0x2);
+     *
+     *  The mask and shift are compile time constants, so each
+     *  access is a single load followed by a shift and a mask.
+     *
+     *  @tparam T The word type i.e. uint8_t, uint16_t, uint32_t, uint64_t
+     *  @tparam Offset The bit offset of the field from the most significant bit
+     *  @tparam Width The number of bits in the field
+     */
+    template <class T, std::size_t Offset, std::size_t Width>
+    struct network_bitfield
+    {
+        static_assert(std::is_integral<T>::value, "T is not an integral type");
+        static_assert(!std::is_signed<T>::value, "T is not unsigned");
+        static_assert(Width > 0, "Width is zero");
+        static_assert(Offset + Width <= std::numeric_limits<T>::digits, "the bitfield does not fit in T");
+
+        using value_type = T;
+
+        /// The bit offset of the field from the most significant bit
+        static constexpr std::size_t offset = Offset;
+
+        /// The number of bits in the field
+        static constexpr std::size_t width = Width;
+
+        /// The number of bits the field is shifted left in the host order word
+        static constexpr std::size_t shift = std::numeric_limits<T>::digits - Offset - Width;
+
+        /// The mask of the field in the host order word
+        static constexpr T mask = static_cast<T>((~std::uintmax_t {0} >> (std::numeric_limits<std::uintmax_t>::digits - Width)) << shift);
+
+        /// Returns the field's value given a word in host byte order
+        static constexpr T get(const T word) noexcept;
+
+        /// Returns the word in host byte order with the field assigned to value
+        static constexpr T set(const T word, const T value) noexcept;
+
+        /** Returns the field's value from a big endian word at data
+         *
+         *  The buffer overloads are named load and store rather than
+         *  get and set so a literal zero word is never ambiguous with
+         *  a null pointer.
+         */
+        static T load(uint8_t const * const data) noexcept;
+
+        /// Assigns the field's value in the big endian word at data
+        static void store(uint8_t * const data, const T value) noexcept;
+
+        /// Returns the field's value from a network_byte_order word
+        static T get(const ndgpp::network_byte_order<T> word) noexcept;
+
+        /// Assigns the field's value in a network_byte_order word
+        static void set(ndgpp::network_byte_order<T> & word, const T value) noexcept;
+
+        /// Returns the field's value from an unaligned_network_byte_order word
+        static T get(const ndgpp::unaligned_network_byte_order<T> & word) noexcept;
+
+        /// Assigns the field's value in an unaligned_network_byte_order word
+        static void set(ndgpp::unaligned_network_byte_order<T> & word, const T value) noexcept;
+    };
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    constexpr std::size_t network_bitfield<T, Offset, Width>::offset;
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    constexpr std::size_t network_bitfield<T, Offset, Width>::width;
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    constexpr std::size_t network_bitfield<T, Offset, Width>::shift;
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    constexpr T network_bitfield<T, Offset, Width>::mask;
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline constexpr T network_bitfield<T, Offset, Width>::get(const T word) noexcept
+    {
+        return static_cast<T>((word & mask) >> shift);
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline constexpr T network_bitfield<T, Offset, Width>::set(const T word, const T value) noexcept
+    {
+        // Bits of value that do not fit in the field are discarded
+        return static_cast<T>((word & static_cast<T>(~mask)) | ((value << shift) & mask));
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline T network_bitfield<T, Offset, Width>::load(uint8_t const * const data) noexcept
+    {
+        T word;
+        std::memcpy(&word, data, sizeof(T));
+        return get(ndgpp::network_to_host(word));
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline void network_bitfield<T, Offset, Width>::store(uint8_t * const data, const T value) noexcept
+    {
+        T word;
+        std::memcpy(&word, data, sizeof(T));
+        word = ndgpp::host_to_network(set(ndgpp::network_to_host(word), value));
+        std::memcpy(data, &word, sizeof(T));
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline T network_bitfield<T, Offset, Width>::get(const ndgpp::network_byte_order<T> word) noexcept
+    {
+        return get(static_cast<T>(word));
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline void network_bitfield<T, Offset, Width>::set(ndgpp::network_byte_order<T> & word, const T value) noexcept
+    {
+        word = set(static_cast<T>(word), value);
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline T network_bitfield<T, Offset, Width>::get(const ndgpp::unaligned_network_byte_order<T> & word) noexcept
+    {
+        return get(static_cast<T>(word));
+    }
+
+    template <class T, std::size_t Offset, std::size_t Width>
+    inline void network_bitfield<T, Offset, Width>::set(ndgpp::unaligned_network_byte_order<T> & word, const T value) noexcept
+    {
+        word = set(static_cast<T>(word), value);
+    }
+}
+
+#endif
@@ -8,131 +8,26 @@
 #include <utility>
 #include <ostream>
 
+#include <libndgpp/endian.hpp>
+#include <libndgpp/endian_value.hpp>
 #include <libndgpp/network_byte_order_ops.hpp>
 
 namespace ndgpp
 {
     /** Stores a native type value in network byte order
      *
-     *  The ndgpp::network_byte_order class is a regular type that
+     *  The ndgpp::network_byte_order type is a regular type that
      *  will seemlessly represent a native type value in network byte
      *  order.
      *
-     *  @tparam T The native type i.e. uint16_t, uint32_t, uint64_t
+     *  @tparam T The native type i.e. uint8_t, uint16_t, uint32_t, uint64_t
      */
     template <class T>
-    class network_byte_order
-    {
-        static_assert(std::is_integral<T>::value, "T is not an integral type");
-        static_assert(!std::is_signed<T>::value, "T is not unsigned");
-
-        public:
-
-        using value_type = T;
-
-        constexpr
-        network_byte_order() noexcept;
-
-        /** Constructs a network_byte_order instance with the specified value
-         *
-         *  @param value An instance of type T in host byte order
-         */
-        explicit
-        constexpr
-        network_byte_order(const T value) noexcept;
-
-        constexpr
-        network_byte_order(const network_byte_order & other) noexcept;
-
-        network_byte_order(network_byte_order && other) noexcept;
-
-
-        /** Assigns this to the value of rhs
-         *
-         *  @param rhs An instance of type T in host byte order
-         */
-        network_byte_order & operator= (const T rhs) noexcept;
-        network_byte_order & operator= (const network_byte_order & rhs) noexcept;
-        network_byte_order & operator= (network_byte_order && rhs) noexcept;
-
+    using network_byte_order = ndgpp::endian_value<T, ndgpp::network_endian>;
 
-        /// Returns the stored value in host byte order
-        constexpr
-        operator value_type () const noexcept;
-
-        /** Returns the address of the underlying value
-         *
-         *  This is useful for sending the value over a socket:
-         *
-         *  \code
-         *  const int ret = send(&v, v.size());
-         */
-        value_type const * operator &() const noexcept;
-        value_type * operator &() noexcept;
-
-        /// Returns the size of the underlying value
-        constexpr std::size_t size() const noexcept;
-
-        void swap(network_byte_order<T> & other) noexcept;
-
-        private:
-
-        value_type value_;
-
-        friend bool operator== <> (const network_byte_order<T>, const network_byte_order<T>);
-        friend bool operator!= <> (const network_byte_order<T>, const network_byte_order<T>);
-        friend bool operator< <> (const network_byte_order<T>, const network_byte_order<T>);
-        friend bool operator> <> (const network_byte_order<T>, const network_byte_order<T>);
-        friend bool operator<= <> (const network_byte_order<T>, const network_byte_order<T>);
-        friend bool operator>= <> (const network_byte_order<T>, const network_byte_order<T>);
-    };
-
-    template <class T>
-    inline
-    bool operator== (const network_byte_order<T> lhs,
-                     const network_byte_order<T> rhs)
+    inline uint8_t host_to_network(const uint8_t val) noexcept
     {
-        return lhs.value_ == rhs.value_;
-    }
-
-    template <class T>
-    inline
-    bool operator!= (const network_byte_order<T> lhs,
-                     const network_byte_order<T> rhs)
-    {
-        return !(lhs == rhs);
-    }
-
-    template <class T>
-    inline
-    bool operator< (const network_byte_order<T> lhs,
-                    const network_byte_order<T> rhs)
-    {
-        return lhs.value_ < rhs.value_;
-    }
-
-    template <class T>
-    inline
-    bool operator> (const network_byte_order<T> lhs,
-                    const network_byte_order<T> rhs)
-    {
-        return rhs < lhs;
-    }
-
-    template <class T>
-    inline
-    bool operator<= (const network_byte_order<T> lhs,
-                     const network_byte_order<T> rhs)
-    {
-        return !(rhs < lhs);
-    }
-
-    template <class T>
-    inline
-    bool operator>= (const network_byte_order<T> lhs,
-                     const network_byte_order<T> rhs)
-    {
-        return !(lhs < rhs);
+        return val;
     }
 
     inline uint16_t host_to_network(const uint16_t val) noexcept
@@ -167,6 +62,11 @@ namespace ndgpp
         return *reinterpret_cast<uint64_t*>(buf.data());
     }
 
+    inline uint8_t network_to_host(const uint8_t val) noexcept
+    {
+        return val;
+    }
+
     inline uint16_t network_to_host(const uint16_t val)
     {
         std::array<uint8_t, 2> buf;
@@ -202,94 +102,6 @@ namespace ndgpp
             static_cast<uint64_t>(buf[6]) << 8  |
             static_cast<uint64_t>(buf[7]);
     }
-
-    template <class T>
-    void swap(network_byte_order<T> & lhs, network_byte_order<T> & rhs)
-    {
-        lhs.swap(rhs);
-    }
-
-    template <class T>
-    inline
-    std::ostream & operator <<(std::ostream & out, const network_byte_order<T> val)
-    {
-        out << static_cast<T>(val);
-        return out;
-    }
-}
-
-template <class T>
-inline
-constexpr
-ndgpp::network_byte_order<T>::network_byte_order() noexcept = default;
-
-template <class T>
-inline
-constexpr
-ndgpp::network_byte_order<T>::network_byte_order(const ndgpp::network_byte_order<T>& other) noexcept = default;
-
-template <class T>
-inline
-ndgpp::network_byte_order<T>::network_byte_order(ndgpp::network_byte_order<T>&& other) noexcept = default;
-
-template <class T>
-inline
-ndgpp::network_byte_order<T> & ndgpp::network_byte_order<T>::operator= (const ndgpp::network_byte_order<T>& other) noexcept = default;
-
-template <class T>
-inline
-ndgpp::network_byte_order<T> & ndgpp::network_byte_order<T>::operator= (ndgpp::network_byte_order<T>&& other) noexcept = default;
-
-template <class T>
-inline
-constexpr
-ndgpp::network_byte_order<T>::network_byte_order(const T value) noexcept:
-    value_(ndgpp::host_to_network(value))
-{}
-
-template <class T>
-inline
-ndgpp::network_byte_order<T> & ndgpp::network_byte_order<T>::operator= (const T value) noexcept
-{
-    this->value_ = ndgpp::host_to_network(value);
-    return *this;
-}
-
-template <class T>
-inline
-constexpr
-ndgpp::network_byte_order<T>::operator T() const noexcept
-{
-    return ndgpp::network_to_host(this->value_);
-}
-
-template <class T>
-inline
-T const * ndgpp::network_byte_order<T>::operator &() const noexcept
-{
-    return &this->value_;
-}
-
-template <class T>
-inline
-T * ndgpp::network_byte_order<T>::operator &() noexcept
-{
-    return &this->value_;
-}
-
-template <class T>
-inline
-constexpr
-std::size_t ndgpp::network_byte_order<T>::size() const noexcept
-{
-    return sizeof(T);
-}
-
-template <class T>
-inline
-void ndgpp::network_byte_order<T>::swap(ndgpp::network_byte_order<T> & other) noexcept
-{
-    std::swap(this->value_, other.value_);
 }
 
 #endif
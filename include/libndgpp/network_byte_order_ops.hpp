@@ -1,28 +1,30 @@
 #ifndef LIBNDGPP_NETWORK_BYTE_ORDER_OPS_HPP
 #define LIBNDGPP_NETWORK_BYTE_ORDER_OPS_HPP
 
+#include <libndgpp/endian.hpp>
+
 namespace ndgpp
 {
-    template <class T>
-    class network_byte_order;
+    template <class T, ndgpp::endian Order>
+    class endian_value;
 
-    template <class T>
-    bool operator== (const network_byte_order<T>, const network_byte_order<T>);
+    template <class T, ndgpp::endian Order>
+    bool operator== (const endian_value<T, Order>, const endian_value<T, Order>);
 
-    template <class T>
-    bool operator!= (const network_byte_order<T>, const network_byte_order<T>);
+    template <class T, ndgpp::endian Order>
+    bool operator!= (const endian_value<T, Order>, const endian_value<T, Order>);
 
-    template <class T>
-    bool operator< (const network_byte_order<T>, const network_byte_order<T>);
+    template <class T, ndgpp::endian Order>
+    bool operator< (const endian_value<T, Order>, const endian_value<T, Order>);
 
-    template <class T>
-    bool operator> (const network_byte_order<T>, const network_byte_order<T>);
+    template <class T, ndgpp::endian Order>
+    bool operator> (const endian_value<T, Order>, const endian_value<T, Order>);
 
-    template <class T>
-    bool operator<= (const network_byte_order<T>, const network_byte_order<T>);
+    template <class T, ndgpp::endian Order>
+    bool operator<= (const endian_value<T, Order>, const endian_value<T, Order>);
 
-    template <class T>
-    bool operator>= (const network_byte_order<T>, const network_byte_order<T>);
+    template <class T, ndgpp::endian Order>
+    bool operator>= (const endian_value<T, Order>, const endian_value<T, Order>);
 }
 
 #endif
@@ -0,0 +1,197 @@
+#ifndef LIBNDGPP_SERIAL_NUMBER_HPP
+#define LIBNDGPP_SERIAL_NUMBER_HPP
+
+#include <cstdint>
+
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include <libndgpp/endian.hpp>
+#include <libndgpp/endian_value.hpp>
+
+namespace ndgpp
+{
+    /** A wrapping sequence number with RFC 1982 serial number arithmetic
+     *
+     *  Serial numbers compare as if the value space was a circle:
+     *  a serial number is less than the serial numbers in the half
+     *  of the circle following it.  So for 16 bit serial numbers,
+     *  65535 is less than 0, and 0 is less than 32767.
+     *
+     *  The comparison of two serial numbers whose distance is
+     *  exactly half of the value space is undefined by RFC 1982.
+     *  For those values both a < b and b < a are true.
+     *
+     *  @tparam T The unsigned integer type i.e. uint16_t or uint32_t
+     *  @tparam Order The byte order the value is stored in.  Using
+     *                ndgpp::network_endian allows the serial number
+     *                to be copied to and from packets as is.
+     */
+    template <class T, ndgpp::endian Order = ndgpp::endian::native>
+    class serial_number
+    {
+        static_assert(std::is_integral<T>::value, "T is not an integral type");
+        static_assert(!std::is_signed<T>::value, "T is not unsigned");
+
+        public:
+
+        using value_type = T;
+
+        /// The signed type of the distance between two serial numbers
+        using difference_type = std::make_signed_t<T>;
+
+        constexpr serial_number() noexcept;
+
+        explicit
+        constexpr serial_number(const T value) noexcept;
+
+        /// Returns the value in host byte order
+        constexpr T value() const noexcept;
+
+        /// Adds n to the serial number, wrapping around the value space
+        serial_number & operator+= (const T n) noexcept;
+
+        serial_number & operator++ () noexcept;
+        serial_number operator++ (int) noexcept;
+
+        void swap(serial_number & other) noexcept;
+
+        private:
+
+        ndgpp::endian_value<T, Order> value_;
+    };
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr serial_number<T, Order>::serial_number() noexcept:
+        value_(T {0})
+    {}
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr serial_number<T, Order>::serial_number(const T value) noexcept:
+        value_(value)
+    {}
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr T serial_number<T, Order>::value() const noexcept
+    {
+        return this->value_;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline serial_number<T, Order> & serial_number<T, Order>::operator+= (const T n) noexcept
+    {
+        this->value_ = static_cast<T>(this->value() + n);
+        return *this;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline serial_number<T, Order> & serial_number<T, Order>::operator++ () noexcept
+    {
+        return *this += 1;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline serial_number<T, Order> serial_number<T, Order>::operator++ (int) noexcept
+    {
+        const serial_number previous = *this;
+        *this += 1;
+        return previous;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline void serial_number<T, Order>::swap(serial_number & other) noexcept
+    {
+        this->value_.swap(other.value_);
+    }
+
+    /** Returns how far to is ahead of from
+     *
+     *  The distance is negative if to is behind from.
+     */
+    template <class T, ndgpp::endian Order>
+    inline constexpr std::make_signed_t<T> distance(const serial_number<T, Order> from,
+                                                    const serial_number<T, Order> to) noexcept
+    {
+        return static_cast<std::make_signed_t<T>>(static_cast<T>(to.value() - from.value()));
+    }
+
+    /** Returns true if value is in the window [first, first + size)
+     *
+     *  The window may wrap around the end of the value space.
+     */
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool in_window(const serial_number<T, Order> value,
+                                    const serial_number<T, Order> first,
+                                    const typename serial_number<T, Order>::value_type size) noexcept
+    {
+        return static_cast<T>(value.value() - first.value()) < size;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline serial_number<T, Order> operator+ (serial_number<T, Order> lhs,
+                                                const typename serial_number<T, Order>::value_type rhs) noexcept
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool operator== (const serial_number<T, Order> lhs,
+                                      const serial_number<T, Order> rhs) noexcept
+    {
+        return lhs.value() == rhs.value();
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool operator!= (const serial_number<T, Order> lhs,
+                                      const serial_number<T, Order> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool operator< (const serial_number<T, Order> lhs,
+                                     const serial_number<T, Order> rhs) noexcept
+    {
+        // rhs is ahead of lhs by [1, 2^(N-1)]
+        return static_cast<T>(rhs.value() - lhs.value() - 1U) < static_cast<T>(T {1} << (std::numeric_limits<T>::digits - 1));
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool operator> (const serial_number<T, Order> lhs,
+                                     const serial_number<T, Order> rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool operator<= (const serial_number<T, Order> lhs,
+                                      const serial_number<T, Order> rhs) noexcept
+    {
+        return lhs == rhs || lhs < rhs;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline constexpr bool operator>= (const serial_number<T, Order> lhs,
+                                      const serial_number<T, Order> rhs) noexcept
+    {
+        return lhs == rhs || rhs < lhs;
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline void swap(serial_number<T, Order> & lhs, serial_number<T, Order> & rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    template <class T, ndgpp::endian Order>
+    inline std::ostream & operator <<(std::ostream & out, const serial_number<T, Order> value)
+    {
+        out << +value.value();
+        return out;
+    }
+}
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef LIBNDGPP_SORTABLE_KEY_HPP
+#define LIBNDGPP_SORTABLE_KEY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <libndgpp/algorithm/accumulate.hpp>
+#include <libndgpp/bounded_integer.hpp>
+#include <libndgpp/endian.hpp>
+#include <libndgpp/endian_value.hpp>
+#include <libndgpp/net/basic_ipv4_address.hpp>
+
+namespace ndgpp
+{
+    /** Describes how a type is encoded in a memcmp sortable key
+     *
+     *  The encoded bytes of two values compare with memcmp in the
+     *  same order as the values compare with operator<.
+     *  Specializations provide the following members:
+     *
+     *  \code
+     *  static constexpr std::size_t size;
+     *  static void encode(uint8_t * const data, const T & value) noexcept;
+     *  static T decode(uint8_t const * const data);
+     *
+     *  The primary template handles integral types.  Unsigned values
+     *  are stored big endian, and signed values have their sign bit
+     *  flipped first so negative values sort before positive ones.
+     *
+     *  @tparam T The type to encode
+     */
+    template <class T, class = void>
+    struct sortable_key_traits;
+
+    template <class T>
+    struct sortable_key_traits<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+    {
+        static constexpr std::size_t size = sizeof(T);
+
+        using unsigned_type = std::make_unsigned_t<T>;
+
+        /// The bit flipped in signed values
+        static constexpr unsigned_type sign_bit = std::is_signed<T>::value ?
+            static_cast<unsigned_type>(unsigned_type {1} << (std::numeric_limits<unsigned_type>::digits - 1)) :
+            unsigned_type {0};
+
+        static void encode(uint8_t * const data, const T value) noexcept
+        {
+            const unsigned_type bits = ndgpp::endian_convert<ndgpp::endian::big>(static_cast<unsigned_type>(static_cast<unsigned_type>(value) ^ sign_bit));
+            std::memcpy(data, &bits, size);
+        }
+
+        static T decode(uint8_t const * const data) noexcept
+        {
+            unsigned_type bits;
+            std::memcpy(&bits, data, size);
+            return static_cast<T>(static_cast<unsigned_type>(ndgpp::endian_convert<ndgpp::endian::big>(bits) ^ sign_bit));
+        }
+    };
+
+    template <class T>
+    constexpr std::size_t sortable_key_traits<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>::size;
+
+    template <class T>
+    constexpr typename sortable_key_traits<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>::unsigned_type
+    sortable_key_traits<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>::sign_bit;
+
+    /// Encodes a bounded_integer as its underlying integer
+    template <class T, T Min, T Max, class Tag>
+    struct sortable_key_traits<ndgpp::bounded_integer<T, Min, Max, Tag>>
+    {
+        using value_type = ndgpp::bounded_integer<T, Min, Max, Tag>;
+        using integer_traits = sortable_key_traits<T>;
+
+        static constexpr std::size_t size = integer_traits::size;
+
+        static void encode(uint8_t * const data, const value_type value) noexcept
+        {
+            integer_traits::encode(data, value.value());
+        }
+
+        /// Throws ndgpp::error<std::out_of_range> if the value is outside of [Min, Max]
+        static value_type decode(uint8_t const * const data)
+        {
+            return value_type {integer_traits::decode(data)};
+        }
+    };
+
+    template <class T, T Min, T Max, class Tag>
+    constexpr std::size_t sortable_key_traits<ndgpp::bounded_integer<T, Min, Max, Tag>>::size;
+
+    /// Encodes an endian_value, i.e. a network_byte_order value, as its host value
+    template <class T, ndgpp::endian Order>
+    struct sortable_key_traits<ndgpp::endian_value<T, Order>>
+    {
+        using value_type = ndgpp::endian_value<T, Order>;
+        using integer_traits = sortable_key_traits<T>;
+
+        static constexpr std::size_t size = integer_traits::size;
+
+        static void encode(uint8_t * const data, const value_type value) noexcept
+        {
+            integer_traits::encode(data, static_cast<T>(value));
+        }
+
+        static value_type decode(uint8_t const * const data) noexcept
+        {
+            return value_type {integer_traits::decode(data)};
+        }
+    };
+
+    template <class T, ndgpp::endian Order>
+    constexpr std::size_t sortable_key_traits<ndgpp::endian_value<T, Order>>::size;
+
+    /// Encodes an IPv4 address as its four octets
+    template <uint32_t Min, uint32_t Max>
+    struct sortable_key_traits<ndgpp::net::basic_ipv4_address<Min, Max>>
+    {
+        using value_type = ndgpp::net::basic_ipv4_address<Min, Max>;
+        using integer_traits = sortable_key_traits<uint32_t>;
+
+        static constexpr std::size_t size = integer_traits::size;
+
+        static void encode(uint8_t * const data, const value_type value) noexcept
+        {
+            integer_traits::encode(data, value.to_uint32());
+        }
+
+        /// Throws ndgpp::error<std::out_of_range> if the address is outside of [Min, Max]
+        static value_type decode(uint8_t const * const data) noexcept(!value_type::constrained)
+        {
+            return value_type {integer_traits::decode(data)};
+        }
+    };
+
+    template <uint32_t Min, uint32_t Max>
+    constexpr std::size_t sortable_key_traits<ndgpp::net::basic_ipv4_address<Min, Max>>::size;
+
+    /** Provides the size in bytes of the sortable key of Ts
+     *
+     *  @tparam Ts The types of the key's components
+     */
+    template <class ... Ts>
+    struct sortable_key_size:
+        std::integral_constant<std::size_t, ndgpp::accumulate(std::size_t {0}, std::size_t {sortable_key_traits<Ts>::size}...)>
+    {};
+
+    /// A sortable key of the component types Ts
+    template <class ... Ts>
+    using sortable_key = std::array<uint8_t, sortable_key_size<Ts...>::value>;
+
+    /** Writes the sortable key of values to data
+     *
+     *  The components are written in order without separators, so
+     *  keys compare lexicographically by component:
+     *
+     *  \code
+     *  uint8_t key[ndgpp::sortable_key_size<ndgpp::net::ipv4_address, ndgpp::net::port>::value];
+     *  ndgpp::encode_sortable_key(key, address, port);
+     *
+     *  @param data The sortable_key_size<Ts...>::value bytes to write to
+     *  @param values The key's components
+     */
+    template <class ... Ts>
+    inline void encode_sortable_key(uint8_t * data, const Ts & ... values) noexcept
+    {
+        using expander = int[];
+        static_cast<void>(expander {0, (sortable_key_traits<Ts>::encode(data, values),
+                                        data += sortable_key_traits<Ts>::size,
+                                        0)...});
+    }
+
+    namespace detail
+    {
+        template <class ... Ts, std::size_t ... Is>
+        inline std::tuple<Ts...> decode_sortable_key(uint8_t const * const data, std::index_sequence<Is...>)
+        {
+            // The offset of component I is the size of the components before it
+            const std::array<std::size_t, sizeof...(Ts)> sizes {{sortable_key_traits<Ts>::size...}};
+            std::array<std::size_t, sizeof...(Ts)> offsets {};
+            for (std::size_t i = 1; i < offsets.size(); ++i)
+            {
+                offsets[i] = offsets[i - 1] + sizes[i - 1];
+            }
+
+            return std::tuple<Ts...> {sortable_key_traits<Ts>::decode(data + offsets[Is])...};
+        }
+    }
+
+    /** Returns the components of the sortable key at data
+     *
+     *  @throw ndgpp::error<std::out_of_range> if a bounded component is out of range
+     */
+    template <class ... Ts>
+    inline std::tuple<Ts...> decode_sortable_key(uint8_t const * const data)
+    {
+        return ndgpp::detail::decode_sortable_key<Ts...>(data, std::index_sequence_for<Ts...> {});
+    }
+
+    /// Returns the sortable key of values
+    template <class ... Ts>
+    inline sortable_key<Ts...> make_sortable_key(const Ts & ... values) noexcept
+    {
+        sortable_key<Ts...> key;
+        ndgpp::encode_sortable_key(key.data(), values...);
+        return key;
+    }
+
+    /// Encodes a tuple as each of its elements in order
+    template <class ... Ts>
+    struct sortable_key_traits<std::tuple<Ts...>>
+    {
+        using value_type = std::tuple<Ts...>;
+
+        static constexpr std::size_t size = sortable_key_size<Ts...>::value;
+
+        static void encode(uint8_t * const data, const value_type & value) noexcept
+        {
+            encode(data, value, std::index_sequence_for<Ts...> {});
+        }
+
+        static value_type decode(uint8_t const * const data)
+        {
+            return ndgpp::decode_sortable_key<Ts...>(data);
+        }
+
+        private:
+
+        template <std::size_t ... Is>
+        static void encode(uint8_t * const data, const value_type & value, std::index_sequence<Is...>) noexcept
+        {
+            ndgpp::encode_sortable_key(data, std::get<Is>(value)...);
+        }
+    };
+
+    template <class ... Ts>
+    constexpr std::size_t sortable_key_traits<std::tuple<Ts...>>::size;
+}
+
+#endif
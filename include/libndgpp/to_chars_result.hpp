@@ -0,0 +1,22 @@
+#ifndef LIBNDGPP_TO_CHARS_RESULT_HPP
+#define LIBNDGPP_TO_CHARS_RESULT_HPP
+
+#include <system_error>
+
+namespace ndgpp
+{
+    /** Represents the result of a to_chars call
+     *
+     *  This mirrors C++17's std::to_chars_result.  On success ptr is
+     *  one past the last character written and ec is a value
+     *  initialized std::errc.  If the value does not fit, ptr is the
+     *  end of the buffer and ec is std::errc::value_too_large.
+     */
+    struct to_chars_result
+    {
+        char * ptr;
+        std::errc ec;
+    };
+}
+
+#endif
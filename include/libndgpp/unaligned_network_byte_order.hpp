@@ -0,0 +1,272 @@
+#ifndef LIBNDGPP_UNALIGNED_NETWORK_BYTE_ORDER_HPP
+#define LIBNDGPP_UNALIGNED_NETWORK_BYTE_ORDER_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <type_traits>
+
+#include <libndgpp/network_byte_order.hpp>
+
+namespace ndgpp
+{
+    /** Stores a native type value in network byte order with an alignment of one
+     *
+     *  The ndgpp::unaligned_network_byte_order class provides the
+     *  same interface as ndgpp::network_byte_order, but its value is
+     *  stored in a byte array.  This allows an instance to be
+     *  overlayed on a buffer at any offset, for example a field
+     *  inside of a received packet:
+     *
+     *  \code
+     *  auto const * len = reinterpret_cast<ndgpp::unaligned_network_byte_order<uint16_t> const *>(buf + 3);
+     *  const uint16_t host_len = *len;
+     *
+     *  @tparam T The native type i.e. uint16_t, uint32_t, uint64_t
+     */
+    template <class T>
+    class unaligned_network_byte_order
+    {
+        static_assert(std::is_integral<T>::value, "T is not an integral type");
+        static_assert(!std::is_signed<T>::value, "T is not unsigned");
+
+        public:
+
+        using value_type = T;
+
+        /// The underlying storage type
+        using array_type = std::array<uint8_t, sizeof(T)>;
+
+        constexpr
+        unaligned_network_byte_order() noexcept;
+
+        /** Constructs an unaligned_network_byte_order instance with the specified value
+         *
+         *  @param value An instance of type T in host byte order
+         */
+        explicit
+        unaligned_network_byte_order(const T value) noexcept;
+
+        /// Constructs an instance with the value of a network_byte_order instance
+        explicit
+        unaligned_network_byte_order(const ndgpp::network_byte_order<T> value) noexcept;
+
+        constexpr
+        unaligned_network_byte_order(const unaligned_network_byte_order & other) noexcept;
+
+        unaligned_network_byte_order(unaligned_network_byte_order && other) noexcept;
+
+        /** Assigns this to the value of rhs
+         *
+         *  @param rhs An instance of type T in host byte order
+         */
+        unaligned_network_byte_order & operator= (const T rhs) noexcept;
+        unaligned_network_byte_order & operator= (const ndgpp::network_byte_order<T> rhs) noexcept;
+        unaligned_network_byte_order & operator= (const unaligned_network_byte_order & rhs) noexcept;
+        unaligned_network_byte_order & operator= (unaligned_network_byte_order && rhs) noexcept;
+
+        /// Returns the stored value in host byte order
+        operator value_type () const noexcept;
+
+        /// Returns the stored value as a network_byte_order instance
+        ndgpp::network_byte_order<T> network_value() const noexcept;
+
+        /** Returns the address of the underlying bytes
+         *
+         *  This is useful for sending the value over a socket:
+         *
+         *  \code
+         *  const int ret = send(&v, v.size());
+         */
+        uint8_t const * operator &() const noexcept;
+        uint8_t * operator &() noexcept;
+
+        /// Returns the size of the underlying value
+        constexpr std::size_t size() const noexcept;
+
+        void swap(unaligned_network_byte_order<T> & other) noexcept;
+
+        private:
+
+        array_type value_;
+    };
+
+    template <class T>
+    inline
+    bool operator== (const unaligned_network_byte_order<T> & lhs,
+                     const unaligned_network_byte_order<T> & rhs) noexcept
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+    }
+
+    template <class T>
+    inline
+    bool operator!= (const unaligned_network_byte_order<T> & lhs,
+                     const unaligned_network_byte_order<T> & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T>
+    inline
+    bool operator< (const unaligned_network_byte_order<T> & lhs,
+                    const unaligned_network_byte_order<T> & rhs) noexcept
+    {
+        return static_cast<T>(lhs) < static_cast<T>(rhs);
+    }
+
+    template <class T>
+    inline
+    bool operator> (const unaligned_network_byte_order<T> & lhs,
+                    const unaligned_network_byte_order<T> & rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    template <class T>
+    inline
+    bool operator<= (const unaligned_network_byte_order<T> & lhs,
+                     const unaligned_network_byte_order<T> & rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T>
+    inline
+    bool operator>= (const unaligned_network_byte_order<T> & lhs,
+                     const unaligned_network_byte_order<T> & rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T>
+    void swap(unaligned_network_byte_order<T> & lhs, unaligned_network_byte_order<T> & rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template <class T>
+    inline
+    std::ostream & operator <<(std::ostream & out, const unaligned_network_byte_order<T> & val)
+    {
+        out << static_cast<T>(val);
+        return out;
+    }
+}
+
+template <class T>
+inline
+constexpr
+ndgpp::unaligned_network_byte_order<T>::unaligned_network_byte_order() noexcept:
+    value_{}
+{}
+
+template <class T>
+inline
+constexpr
+ndgpp::unaligned_network_byte_order<T>::unaligned_network_byte_order(const ndgpp::unaligned_network_byte_order<T>& other) noexcept = default;
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T>::unaligned_network_byte_order(ndgpp::unaligned_network_byte_order<T>&& other) noexcept = default;
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T> &
+ndgpp::unaligned_network_byte_order<T>::operator= (const ndgpp::unaligned_network_byte_order<T>& other) noexcept = default;
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T> &
+ndgpp::unaligned_network_byte_order<T>::operator= (ndgpp::unaligned_network_byte_order<T>&& other) noexcept = default;
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T>::unaligned_network_byte_order(const T value) noexcept
+{
+    *this = value;
+}
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T>::unaligned_network_byte_order(const ndgpp::network_byte_order<T> value) noexcept
+{
+    *this = value;
+}
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T> &
+ndgpp::unaligned_network_byte_order<T>::operator= (const T value) noexcept
+{
+    // memcpy of a fixed size is lowered to a single unaligned store
+    const T network_value = ndgpp::host_to_network(value);
+    std::memcpy(this->value_.data(), &network_value, sizeof(T));
+    return *this;
+}
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T> &
+ndgpp::unaligned_network_byte_order<T>::operator= (const ndgpp::network_byte_order<T> value) noexcept
+{
+    std::memcpy(this->value_.data(), &value, sizeof(T));
+    return *this;
+}
+
+template <class T>
+inline
+ndgpp::unaligned_network_byte_order<T>::operator T() const noexcept
+{
+    static_assert(alignof(unaligned_network_byte_order) == 1, "unaligned_network_byte_order alignment is not one");
+    static_assert(sizeof(unaligned_network_byte_order) == sizeof(T), "unaligned_network_byte_order has padding");
+
+    // memcpy of a fixed size is lowered to a single unaligned load
+    T network_value;
+    std::memcpy(&network_value, this->value_.data(), sizeof(T));
+    return ndgpp::network_to_host(network_value);
+}
+
+template <class T>
+inline
+ndgpp::network_byte_order<T>
+ndgpp::unaligned_network_byte_order<T>::network_value() const noexcept
+{
+    ndgpp::network_byte_order<T> value;
+    std::memcpy(&value, this->value_.data(), sizeof(T));
+    return value;
+}
+
+template <class T>
+inline
+uint8_t const * ndgpp::unaligned_network_byte_order<T>::operator &() const noexcept
+{
+    return this->value_.data();
+}
+
+template <class T>
+inline
+uint8_t * ndgpp::unaligned_network_byte_order<T>::operator &() noexcept
+{
+    return this->value_.data();
+}
+
+template <class T>
+inline
+constexpr
+std::size_t ndgpp::unaligned_network_byte_order<T>::size() const noexcept
+{
+    return sizeof(T);
+}
+
+template <class T>
+inline
+void ndgpp::unaligned_network_byte_order<T>::swap(ndgpp::unaligned_network_byte_order<T> & other) noexcept
+{
+    std::swap(this->value_, other.value_);
+}
+
+#endif
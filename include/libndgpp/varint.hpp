@@ -0,0 +1,269 @@
+#ifndef LIBNDGPP_VARINT_HPP
+#define LIBNDGPP_VARINT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <limits>
+#include <type_traits>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include <libndgpp/varint_result.hpp>
+
+namespace ndgpp
+{
+    /** Maps a signed integer to an unsigned integer so values near zero have small encodings
+     *
+     *  0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+     */
+    template <class T>
+    constexpr std::make_unsigned_t<T> zigzag_encode(const T value) noexcept
+    {
+        static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "T is not a signed integral type");
+
+        using unsigned_type = std::make_unsigned_t<T>;
+        return static_cast<unsigned_type>(static_cast<unsigned_type>(static_cast<unsigned_type>(value) << 1) ^
+                                          (unsigned_type {0} - static_cast<unsigned_type>(value < 0)));
+    }
+
+    /// Reverses ndgpp::zigzag_encode
+    template <class T>
+    constexpr std::make_signed_t<T> zigzag_decode(const T value) noexcept
+    {
+        static_assert(std::is_integral<T>::value && !std::is_signed<T>::value, "T is not an unsigned integral type");
+
+        return static_cast<std::make_signed_t<T>>((value >> 1) ^ (T {0} - (value & 1)));
+    }
+
+    /// Provides the maximum number of bytes in a varint encoding of T
+    template <class T>
+    struct varint_max_size:
+        std::integral_constant<std::size_t, (std::numeric_limits<std::make_unsigned_t<T>>::digits + 6) / 7>
+    {};
+
+    namespace detail
+    {
+        template <class T>
+        inline constexpr std::make_unsigned_t<T> varint_unsigned(const T value, std::true_type) noexcept
+        {
+            return ndgpp::zigzag_encode(value);
+        }
+
+        template <class T>
+        inline constexpr T varint_unsigned(const T value, std::false_type) noexcept
+        {
+            return value;
+        }
+
+        template <class T>
+        inline constexpr T varint_signed(const std::make_unsigned_t<T> value, std::true_type) noexcept
+        {
+            return ndgpp::zigzag_decode(value);
+        }
+
+        template <class T>
+        inline constexpr T varint_signed(const T value, std::false_type) noexcept
+        {
+            return value;
+        }
+
+        template <class U>
+        varint_result<U> varint_decode(uint8_t const * const first, uint8_t const * const last) noexcept
+        {
+            constexpr std::size_t max_size = ndgpp::varint_max_size<U>::value;
+
+            // The number of value bits in the last byte of a max_size encoding
+            constexpr unsigned last_bits = std::numeric_limits<U>::digits - (7 * (max_size - 1));
+
+#if defined(__BMI2__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (last - first >= 8)
+            {
+                // Locate the terminating byte in one load and gather
+                // the value bits with a single pext
+                uint64_t word;
+                std::memcpy(&word, first, sizeof(word));
+                const uint64_t stops = ~word & 0x8080808080808080;
+                if (stops != 0)
+                {
+                    const unsigned bits = static_cast<unsigned>(__builtin_ctzll(stops)) + 1;
+                    const std::size_t size = bits / 8;
+                    const uint64_t mask = bits == 64 ? ~uint64_t {0} : (uint64_t {1} << bits) - 1;
+                    const uint64_t value = _pext_u64(word & mask, 0x7f7f7f7f7f7f7f7f);
+                    if (size > max_size || value > std::numeric_limits<U>::max())
+                    {
+                        return varint_result<U> {varint_result<U>::overlong_value, first};
+                    }
+
+                    return varint_result<U> {static_cast<U>(value), first + size};
+                }
+            }
+#endif
+
+            uint64_t value = 0;
+            for (std::size_t i = 0; i < max_size; ++i)
+            {
+                if (first + i == last)
+                {
+                    return varint_result<U> {varint_result<U>::truncated_value, first};
+                }
+
+                const uint8_t byte = first[i];
+                value |= static_cast<uint64_t>(byte & 0x7f) << (7 * i);
+                if ((byte & 0x80) == 0)
+                {
+                    if (i == max_size - 1 && byte >= (1U << last_bits))
+                    {
+                        return varint_result<U> {varint_result<U>::overlong_value, first};
+                    }
+
+                    return varint_result<U> {static_cast<U>(value), first + i + 1};
+                }
+            }
+
+            return varint_result<U> {varint_result<U>::overlong_value, first};
+        }
+    }
+
+    /** Returns the number of bytes in the varint encoding of value
+     *
+     *  The size is computed without branches from the number of
+     *  significant bits in the value.
+     */
+    template <class T>
+    inline std::size_t varint_size(const T value) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "T is not an integral type");
+
+        const uint64_t unsigned_value = detail::varint_unsigned(value, std::is_signed<T> {});
+        const unsigned bits = 64 - static_cast<unsigned>(__builtin_clzll(unsigned_value | 1));
+
+        // ceil(bits / 7) for bits in [1, 64]
+        return (bits * 9 + 64) / 64;
+    }
+
+    /** Writes the LEB128 encoding of value
+     *
+     *  Signed values are zigzag encoded first, see ndgpp::zigzag_encode.
+     *
+     *  @param value The value to encode
+     *  @param out The output buffer, it must have room for
+     *             ndgpp::varint_size(value) bytes
+     *
+     *  @return One past the last byte written
+     */
+    template <class T>
+    inline uint8_t * varint_encode(const T value, uint8_t * out) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "T is not an integral type");
+
+        uint64_t unsigned_value = detail::varint_unsigned(value, std::is_signed<T> {});
+        while (unsigned_value >= 0x80)
+        {
+            *out++ = static_cast<uint8_t>(unsigned_value | 0x80);
+            unsigned_value >>= 7;
+        }
+
+        *out++ = static_cast<uint8_t>(unsigned_value);
+        return out;
+    }
+
+    /** Writes the LEB128 encoding of each value in [first, last)
+     *
+     *  @param out The output buffer, it must have room for the sum
+     *             of ndgpp::varint_size for each value
+     *
+     *  @return One past the last byte written
+     */
+    template <class T>
+    inline uint8_t * varint_encode(T const * first, T const * const last, uint8_t * out) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            out = ndgpp::varint_encode(*first, out);
+        }
+
+        return out;
+    }
+
+    /** Decodes a LEB128 encoded value
+     *
+     *  Signed values are zigzag decoded, see ndgpp::zigzag_decode.
+     *
+     *  @tparam T The type of integer to decode
+     *
+     *  @param first The first byte of the encoding
+     *  @param last One past the last byte of the input
+     *
+     *  @return A ndgpp::varint_result object.  The result is
+     *          truncated if last is reached before the end of the
+     *          encoding, and overlong if the encoding has more than
+     *          ndgpp::varint_max_size<T> bytes or its value does not
+     *          fit in T.
+     */
+    template <class T>
+    inline varint_result<T> varint_decode(uint8_t const * const first, uint8_t const * const last) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "T is not an integral type");
+
+        using unsigned_type = std::make_unsigned_t<T>;
+        const varint_result<unsigned_type> result = detail::varint_decode<unsigned_type>(first, last);
+        if (result)
+        {
+            return varint_result<T> {detail::varint_signed<T>(result.value(), std::is_signed<T> {}), result.unparsed()};
+        }
+
+        if (result.truncated())
+        {
+            return varint_result<T> {varint_result<T>::truncated_value, result.unparsed()};
+        }
+
+        return varint_result<T> {varint_result<T>::overlong_value, result.unparsed()};
+    }
+
+    /** Decodes up to count LEB128 encoded values
+     *
+     *  Decoding stops after count values or when last is reached.
+     *
+     *  @param first The first byte of the input
+     *  @param last One past the last byte of the input
+     *  @param out Receives the decoded values
+     *  @param count The maximum number of values to decode
+     *
+     *  @return A ndgpp::varint_result containing the number of
+     *          values decoded.  On error, unparsed points to the
+     *          varint that failed to decode, and the values
+     *          preceding it have been written to out.
+     */
+    template <class T>
+    inline varint_result<std::size_t> varint_decode(uint8_t const * first,
+                                                    uint8_t const * const last,
+                                                    T * const out,
+                                                    const std::size_t count) noexcept
+    {
+        std::size_t i = 0;
+        for (; i < count && first != last; ++i)
+        {
+            const varint_result<T> result = ndgpp::varint_decode<T>(first, last);
+            if (!result)
+            {
+                if (result.truncated())
+                {
+                    return varint_result<std::size_t> {varint_result<std::size_t>::truncated_value, first};
+                }
+
+                return varint_result<std::size_t> {varint_result<std::size_t>::overlong_value, first};
+            }
+
+            out[i] = result.value();
+            first = result.unparsed();
+        }
+
+        return varint_result<std::size_t> {i, first};
+    }
+}
+
+#endif
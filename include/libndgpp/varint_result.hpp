@@ -0,0 +1,127 @@
+#ifndef LIBNDGPP_VARINT_RESULT_HPP
+#define LIBNDGPP_VARINT_RESULT_HPP
+
+#include <cstdint>
+
+#include <stdexcept>
+#include <type_traits>
+
+#include <libndgpp/error.hpp>
+
+namespace ndgpp
+{
+    /** Represents the result of a varint decode
+     *
+     *  @tparam T The integer type of the decode
+     */
+    template <class T>
+    class varint_result final
+    {
+        public:
+
+        using value_type = std::decay_t<T>;
+
+        struct truncated_t {};
+        struct overlong_t {};
+
+        static constexpr truncated_t truncated_value = {};
+        static constexpr overlong_t overlong_value = {};
+
+        varint_result(const T value, uint8_t const * const unparsed) noexcept;
+        varint_result(truncated_t, uint8_t const * const unparsed) noexcept;
+        varint_result(overlong_t, uint8_t const * const unparsed) noexcept;
+
+        explicit operator bool() const noexcept;
+
+        /// Returns true if the input ended before the last byte of a varint
+        bool truncated() const noexcept;
+
+        /// Returns true if the varint does not fit in T
+        bool overlong() const noexcept;
+
+        value_type value() const;
+
+        /** Returns the first byte that was not decoded
+         *
+         *  If an error occurred, this is the first byte of the varint
+         *  that could not be decoded.
+         */
+        uint8_t const * unparsed() const noexcept;
+
+        private:
+
+        enum class error_type
+        {
+            none,
+            truncated,
+            overlong,
+        };
+
+        T value_ = {};
+        error_type error_;
+        uint8_t const * unparsed_;
+    };
+
+    template <class T>
+    constexpr typename varint_result<T>::truncated_t varint_result<T>::truncated_value;
+
+    template <class T>
+    constexpr typename varint_result<T>::overlong_t varint_result<T>::overlong_value;
+
+    template <class T>
+    inline varint_result<T>::varint_result(const T value, uint8_t const * const unparsed) noexcept:
+        value_(value),
+        error_(error_type::none),
+        unparsed_(unparsed)
+    {}
+
+    template <class T>
+    inline varint_result<T>::varint_result(truncated_t, uint8_t const * const unparsed) noexcept:
+        error_(error_type::truncated),
+        unparsed_(unparsed)
+    {}
+
+    template <class T>
+    inline varint_result<T>::varint_result(overlong_t, uint8_t const * const unparsed) noexcept:
+        error_(error_type::overlong),
+        unparsed_(unparsed)
+    {}
+
+    template <class T>
+    inline varint_result<T>::operator bool() const noexcept
+    {
+        return this->error_ == error_type::none;
+    }
+
+    template <class T>
+    inline bool varint_result<T>::truncated() const noexcept
+    {
+        return this->error_ == error_type::truncated;
+    }
+
+    template <class T>
+    inline bool varint_result<T>::overlong() const noexcept
+    {
+        return this->error_ == error_type::overlong;
+    }
+
+    template <class T>
+    inline std::decay_t<T> varint_result<T>::value() const
+    {
+        if (!(*this))
+        {
+            throw ndgpp_error(std::logic_error,
+                              "varint_result value not set");
+        }
+
+        return this->value_;
+    }
+
+    template <class T>
+    inline uint8_t const * varint_result<T>::unparsed() const noexcept
+    {
+        return this->unparsed_;
+    }
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef LIBNDGPP_WIRE_LAYOUT_HPP
+#define LIBNDGPP_WIRE_LAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <libndgpp/algorithm/accumulate.hpp>
+#include <libndgpp/network_byte_order.hpp>
+#include <libndgpp/tuple.hpp>
+#include <libndgpp/unaligned_network_byte_order.hpp>
+
+namespace ndgpp
+{
+    /** Maps a field type to the type used to access it in a buffer
+     *
+     *  The wire type must have an alignment of one so it can be
+     *  accessed at any offset in a buffer.
+     *
+     *  @tparam T The field type
+     */
+    template <class T>
+    struct wire_type
+    {
+        using type = T;
+    };
+
+    template <class T>
+    struct wire_type<ndgpp::network_byte_order<T>>
+    {
+        using type = ndgpp::unaligned_network_byte_order<T>;
+    };
+
+    template <class T>
+    using wire_type_t = typename wire_type<T>::type;
+
+    /** Declares a named field in a wire_layout
+     *
+     *  @tparam Tag The type used to name the field
+     *  @tparam T The field's type i.e. network_byte_order<uint16_t>,
+     *            std::array<uint8_t, 6>, uint8_t
+     */
+    template <class Tag, class T>
+    struct wire_field
+    {
+        using tag_type = Tag;
+        using value_type = T;
+        using wire_type = ndgpp::wire_type_t<T>;
+
+        static_assert(alignof(wire_type) == 1, "wire type has an alignment greater than one");
+    };
+
+    /** Describes the layout of a protocol header as an ordered list of fields
+     *
+     *  \code
+     *  struct length;
+     *  struct type;
+     *  struct mac;
+     *
+     *  using header = ndgpp::wire_layout<ndgpp::wire_field<length, ndgpp::network_byte_order<uint16_t>>,
+     *                                    ndgpp::wire_field<type, uint8_t>,
+     *                                    ndgpp::wire_field<mac, std::array<uint8_t, 6>>>;
+     *
+     *  static_assert(header::size == 9, "");
+     *  static_assert(header::offset<mac>() == 3, "");
+     *
+     *  @tparam Fields The ndgpp::wire_field types in wire order
+     */
+    template <class ... Fields>
+    class wire_layout
+    {
+        public:
+
+        /// A tuple of the field tags
+        using tags_type = std::tuple<typename Fields::tag_type...>;
+
+        /// A tuple of the types used to access the fields in a buffer
+        using wire_types_type = std::tuple<typename Fields::wire_type...>;
+
+        /// The size of the layout in bytes
+        static constexpr std::size_t size = ndgpp::accumulate(std::size_t {0}, sizeof(typename Fields::wire_type)...);
+
+        /// Provides the index of the field named Tag
+        template <class Tag>
+        static constexpr std::size_t index() noexcept;
+
+        /// Provides the offset in bytes of the field named Tag
+        template <class Tag>
+        static constexpr std::size_t offset() noexcept;
+
+        /// The type used to access the field named Tag
+        template <class Tag>
+        using field_type = std::tuple_element_t<index<Tag>(), wire_types_type>;
+
+        private:
+
+        template <std::size_t ... Is>
+        static constexpr std::size_t offset(std::index_sequence<Is...>) noexcept;
+    };
+
+    template <class ... Fields>
+    constexpr std::size_t wire_layout<Fields...>::size;
+
+    template <class ... Fields>
+    template <class Tag>
+    inline constexpr std::size_t wire_layout<Fields...>::index() noexcept
+    {
+        static_assert(ndgpp::tuple_contains<Tag, tags_type>::value, "Tag is not a field of the layout");
+        return ndgpp::tuple_index<Tag, tags_type>::value;
+    }
+
+    template <class ... Fields>
+    template <class Tag>
+    inline constexpr std::size_t wire_layout<Fields...>::offset() noexcept
+    {
+        return offset(std::make_index_sequence<index<Tag>()> {});
+    }
+
+    template <class ... Fields>
+    template <std::size_t ... Is>
+    inline constexpr std::size_t wire_layout<Fields...>::offset(std::index_sequence<Is...>) noexcept
+    {
+        return ndgpp::accumulate(std::size_t {0}, sizeof(std::tuple_element_t<Is, wire_types_type>)...);
+    }
+
+    /** A zero-copy view of a wire_layout over a buffer
+     *
+     *  The view does not own the buffer, and the buffer must be at
+     *  least Layout::size bytes long.
+     *
+     *  \code
+     *  ndgpp::wire_view<header> view {buf};
+     *  const uint16_t len = view.get<length>();
+     *  view.get<type>() = 4;
+     *
+     *  @tparam Layout The ndgpp::wire_layout type
+     *  @tparam Byte The buffer's byte type, use const uint8_t for a read-only view
+     */
+    template <class Layout, class Byte = uint8_t>
+    class wire_view
+    {
+        static_assert(std::is_same<std::remove_const_t<Byte>, uint8_t>::value, "Byte is not a uint8_t");
+
+        public:
+
+        using layout_type = Layout;
+
+        /// The size of the view in bytes
+        static constexpr std::size_t size = Layout::size;
+
+        /// Constructs a view over the buffer pointed to by data
+        explicit
+        constexpr wire_view(Byte * data) noexcept;
+
+        /// Returns a reference to the field named Tag
+        template <class Tag>
+        decltype(auto) get() const noexcept;
+
+        /// Returns the address of the viewed buffer
+        constexpr Byte * data() const noexcept;
+
+        private:
+
+        Byte * data_;
+    };
+
+    template <class Layout, class Byte>
+    constexpr std::size_t wire_view<Layout, Byte>::size;
+
+    template <class Layout, class Byte>
+    inline constexpr wire_view<Layout, Byte>::wire_view(Byte * data) noexcept:
+        data_(data)
+    {}
+
+    template <class Layout, class Byte>
+    template <class Tag>
+    inline decltype(auto) wire_view<Layout, Byte>::get() const noexcept
+    {
+        using field_type = typename Layout::template field_type<Tag>;
+        using pointer_type = std::conditional_t<std::is_const<Byte>::value, field_type const *, field_type *>;
+        return *reinterpret_cast<pointer_type>(this->data_ + Layout::template offset<Tag>());
+    }
+
+    template <class Layout, class Byte>
+    inline constexpr Byte * wire_view<Layout, Byte>::data() const noexcept
+    {
+        return this->data_;
+    }
+}
+
+#endif
@@ -0,0 +1,253 @@
+#include <cstring>
+
+#include <array>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+#include <libndgpp/crc32c.hpp>
+
+namespace
+{
+    // The reflected Castagnoli polynomial
+    constexpr uint32_t polynomial = 0x82f63b78;
+
+    /* Returns a * b modulo the polynomial, where a and b are
+     * reflected polynomials i.e. bit 31 is the x^0 coefficient
+     */
+    uint32_t multiply_modulo(const uint32_t a, uint32_t b) noexcept
+    {
+        uint32_t product = 0;
+        for (uint32_t m = uint32_t {1} << 31; m != 0; m >>= 1)
+        {
+            if (a & m)
+            {
+                product ^= b;
+            }
+
+            b = b & 1 ? (b >> 1) ^ polynomial : b >> 1;
+        }
+
+        return product;
+    }
+
+    /// Returns x^(8 * size) modulo the polynomial
+    uint32_t x8n_modulo(std::size_t size) noexcept
+    {
+        // x^(2^k) for k = 3, which is x^8
+        uint32_t power = uint32_t {1} << 30;
+        for (int i = 0; i < 3; ++i)
+        {
+            power = multiply_modulo(power, power);
+        }
+
+        uint32_t result = uint32_t {1} << 31;
+        for (; size != 0; size >>= 1)
+        {
+            if (size & 1)
+            {
+                result = multiply_modulo(power, result);
+            }
+
+            power = multiply_modulo(power, power);
+        }
+
+        return result;
+    }
+
+    /* Slicing by 8 tables for the portable implementation */
+    struct slicing_tables
+    {
+        slicing_tables() noexcept
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int j = 0; j < 8; ++j)
+                {
+                    crc = crc & 1 ? (crc >> 1) ^ polynomial : crc >> 1;
+                }
+
+                table[0][i] = crc;
+            }
+
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (std::size_t k = 1; k < table.size(); ++k)
+                {
+                    table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff];
+                }
+            }
+        }
+
+        std::array<std::array<uint32_t, 256>, 8> table;
+    };
+
+    const slicing_tables & get_slicing_tables() noexcept
+    {
+        static const slicing_tables tables;
+        return tables;
+    }
+
+#if defined(__x86_64__)
+
+    /* Tables that advance a crc register over Size zero bytes with
+     * four table lookups.  They are used to combine the registers
+     * of the interleaved streams in the hardware implementation.
+     */
+    template <std::size_t Size>
+    struct shift_tables
+    {
+        shift_tables() noexcept
+        {
+            const uint32_t power = x8n_modulo(Size);
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (std::size_t k = 0; k < table.size(); ++k)
+                {
+                    table[k][i] = multiply_modulo(power, i << (8 * k));
+                }
+            }
+        }
+
+        uint32_t shift(const uint32_t crc) const noexcept
+        {
+            return table[0][crc & 0xff] ^
+                table[1][(crc >> 8) & 0xff] ^
+                table[2][(crc >> 16) & 0xff] ^
+                table[3][crc >> 24];
+        }
+
+        std::array<std::array<uint32_t, 256>, 4> table;
+    };
+
+    constexpr std::size_t long_block_size = 8192;
+    constexpr std::size_t short_block_size = 256;
+
+    template <std::size_t Size>
+    const shift_tables<Size> & get_shift_tables() noexcept
+    {
+        static const shift_tables<Size> tables;
+        return tables;
+    }
+
+    inline uint64_t load64(uint8_t const * const data) noexcept
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    /* Computes three streams of BlockSize bytes at a time so the
+     * three cycle latency of the crc32 instruction is hidden.
+     */
+    template <std::size_t BlockSize>
+    __attribute__((target("sse4.2")))
+    uint64_t crc32c_interleaved(uint64_t crc0, uint8_t const * & data, std::size_t & size) noexcept
+    {
+        const shift_tables<BlockSize> & tables = get_shift_tables<BlockSize>();
+        while (size >= BlockSize * 3)
+        {
+            uint64_t crc1 = 0;
+            uint64_t crc2 = 0;
+            uint8_t const * const end = data + BlockSize;
+            do
+            {
+                crc0 = _mm_crc32_u64(crc0, load64(data));
+                crc1 = _mm_crc32_u64(crc1, load64(data + BlockSize));
+                crc2 = _mm_crc32_u64(crc2, load64(data + BlockSize * 2));
+                data += sizeof(uint64_t);
+            } while (data < end);
+
+            crc0 = tables.shift(static_cast<uint32_t>(crc0)) ^ crc1;
+            crc0 = tables.shift(static_cast<uint32_t>(crc0)) ^ crc2;
+            data += BlockSize * 2;
+            size -= BlockSize * 3;
+        }
+
+        return crc0;
+    }
+
+    __attribute__((target("sse4.2")))
+    uint32_t crc32c_hardware(void const * const data, std::size_t size, const uint32_t crc) noexcept
+    {
+        uint8_t const * bytes = static_cast<uint8_t const *>(data);
+        uint64_t crc0 = ~crc;
+
+        crc0 = crc32c_interleaved<long_block_size>(crc0, bytes, size);
+        crc0 = crc32c_interleaved<short_block_size>(crc0, bytes, size);
+
+        for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t))
+        {
+            crc0 = _mm_crc32_u64(crc0, load64(bytes));
+        }
+
+        uint32_t crc32 = static_cast<uint32_t>(crc0);
+        for (; size > 0; --size, ++bytes)
+        {
+            crc32 = _mm_crc32_u8(crc32, *bytes);
+        }
+
+        return ~crc32;
+    }
+
+#endif
+
+    using crc32c_function = uint32_t (*)(void const *, std::size_t, uint32_t);
+
+    crc32c_function select_crc32c() noexcept
+    {
+#if defined(__x86_64__)
+        if (__builtin_cpu_supports("sse4.2"))
+        {
+            return crc32c_hardware;
+        }
+#endif
+
+        return ndgpp::detail::crc32c_portable;
+    }
+}
+
+uint32_t ndgpp::detail::crc32c_portable(void const * const data, std::size_t size, const uint32_t crc) noexcept
+{
+    const auto & table = get_slicing_tables().table;
+    uint8_t const * bytes = static_cast<uint8_t const *>(data);
+    uint32_t crc32 = ~crc;
+
+    for (; size >= 8; size -= 8, bytes += 8)
+    {
+        const uint32_t low = crc32 ^
+            (static_cast<uint32_t>(bytes[0]) |
+             static_cast<uint32_t>(bytes[1]) << 8 |
+             static_cast<uint32_t>(bytes[2]) << 16 |
+             static_cast<uint32_t>(bytes[3]) << 24);
+
+        crc32 = table[7][low & 0xff] ^
+            table[6][(low >> 8) & 0xff] ^
+            table[5][(low >> 16) & 0xff] ^
+            table[4][low >> 24] ^
+            table[3][bytes[4]] ^
+            table[2][bytes[5]] ^
+            table[1][bytes[6]] ^
+            table[0][bytes[7]];
+    }
+
+    for (; size > 0; --size, ++bytes)
+    {
+        crc32 = (crc32 >> 8) ^ table[0][(crc32 ^ *bytes) & 0xff];
+    }
+
+    return ~crc32;
+}
+
+uint32_t ndgpp::crc32c(void const * const data, const std::size_t size, const uint32_t crc) noexcept
+{
+    static const crc32c_function function = select_crc32c();
+    return function(data, size, crc);
+}
+
+uint32_t ndgpp::crc32c_combine(const uint32_t crc1, const uint32_t crc2, const std::size_t size2) noexcept
+{
+    return multiply_modulo(x8n_modulo(size2), crc1) ^ crc2;
+}
@@ -0,0 +1,132 @@
+#include <cstring>
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <libndgpp/net/internet_checksum.hpp>
+
+namespace
+{
+    /* The sums below are computed on words loaded in host byte
+     * order.  The ones' complement sum is independent of byte order
+     * (RFC 1071 section 2), so the folded sum is the network byte
+     * order sum of the buffer as it is laid out in memory.
+     */
+
+    inline uint64_t add_with_carry(const uint64_t lhs, const uint64_t rhs) noexcept
+    {
+        const uint64_t sum = lhs + rhs;
+        return sum + (sum < lhs);
+    }
+
+    inline uint16_t fold(uint64_t sum) noexcept
+    {
+        sum = (sum & 0xffffffff) + (sum >> 32);
+        sum = (sum & 0xffffffff) + (sum >> 32);
+        return ndgpp::net::detail::fold_ones_complement_sum(static_cast<uint32_t>(sum));
+    }
+
+    /* Sums at most max_block_size bytes.  32 bit words are added to
+     * 64 bit accumulators, which leaves 32 bits of headroom for
+     * carries, so no carry handling is needed in the loops.
+     */
+    constexpr std::size_t max_block_size = std::size_t {1} << 30;
+
+    uint64_t sum_block(uint8_t const * data, std::size_t size) noexcept
+    {
+        uint64_t sum = 0;
+
+#if defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        __m128i acc0 = zero;
+        __m128i acc1 = zero;
+        for (; size >= 32; size -= 32, data += 32)
+        {
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 16));
+            acc0 = _mm_add_epi64(acc0, _mm_unpacklo_epi32(v0, zero));
+            acc1 = _mm_add_epi64(acc1, _mm_unpackhi_epi32(v0, zero));
+            acc0 = _mm_add_epi64(acc0, _mm_unpacklo_epi32(v1, zero));
+            acc1 = _mm_add_epi64(acc1, _mm_unpackhi_epi32(v1, zero));
+        }
+
+        alignas(16) uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i *>(lanes), _mm_add_epi64(acc0, acc1));
+        sum = lanes[0] + lanes[1];
+#else
+        uint64_t acc0 = 0;
+        uint64_t acc1 = 0;
+        for (; size >= 16; size -= 16, data += 16)
+        {
+            uint64_t words[2];
+            std::memcpy(words, data, sizeof(words));
+            acc0 += (words[0] & 0xffffffff) + (words[0] >> 32);
+            acc1 += (words[1] & 0xffffffff) + (words[1] >> 32);
+        }
+
+        sum = acc0 + acc1;
+#endif
+
+        for (; size >= 4; size -= 4, data += 4)
+        {
+            uint32_t word;
+            std::memcpy(&word, data, sizeof(word));
+            sum += word;
+        }
+
+        if (size >= 2)
+        {
+            uint16_t word;
+            std::memcpy(&word, data, sizeof(word));
+            sum += word;
+            size -= 2;
+            data += 2;
+        }
+
+        if (size == 1)
+        {
+            // The last byte is padded with a zero byte
+            const uint8_t bytes[2] = {*data, 0};
+            uint16_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            sum += word;
+        }
+
+        return sum;
+    }
+}
+
+ndgpp::network_byte_order<uint16_t>
+ndgpp::net::ones_complement_sum(void const * const data,
+                                const std::size_t size,
+                                const ndgpp::network_byte_order<uint16_t> initial) noexcept
+{
+    uint8_t const * bytes = static_cast<uint8_t const *>(data);
+
+    uint16_t initial_word;
+    std::memcpy(&initial_word, &initial, sizeof(initial_word));
+
+    uint64_t sum = initial_word;
+    for (std::size_t remaining = size; remaining > 0;)
+    {
+        const std::size_t block_size = std::min(remaining, max_block_size);
+        sum = add_with_carry(sum, sum_block(bytes, block_size));
+        bytes += block_size;
+        remaining -= block_size;
+    }
+
+    const uint16_t folded = fold(sum);
+    ndgpp::network_byte_order<uint16_t> result;
+    std::memcpy(&result, &folded, sizeof(folded));
+    return result;
+}
+
+ndgpp::network_byte_order<uint16_t>
+ndgpp::net::internet_checksum(void const * const data, const std::size_t size) noexcept
+{
+    const uint16_t sum = ndgpp::net::ones_complement_sum(data, size);
+    return ndgpp::network_byte_order<uint16_t> {static_cast<uint16_t>(~sum)};
+}
@@ -0,0 +1,36 @@
+#include <cerrno>
+
+#include <system_error>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipfix_file_sink.hpp>
+
+ndgpp::net::ipfix_file_sink::ipfix_file_sink(const std::string & path):
+    file_(std::fopen(path.c_str(), "wb"))
+{
+    if (this->file_ == nullptr)
+    {
+        throw ndgpp_error(std::system_error, errno, std::generic_category(), "failed to open IPFIX file");
+    }
+}
+
+ndgpp::net::ipfix_file_sink::~ipfix_file_sink() noexcept
+{
+    std::fclose(this->file_);
+}
+
+void ndgpp::net::ipfix_file_sink::write(uint8_t const * const data, const std::size_t size)
+{
+    if (std::fwrite(data, 1, size, this->file_) != size)
+    {
+        throw ndgpp_error(std::system_error, errno, std::generic_category(), "failed to write IPFIX message");
+    }
+}
+
+void ndgpp::net::ipfix_file_sink::flush()
+{
+    if (std::fflush(this->file_) != 0)
+    {
+        throw ndgpp_error(std::system_error, errno, std::generic_category(), "failed to flush IPFIX file");
+    }
+}
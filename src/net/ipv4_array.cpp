@@ -1,8 +1,12 @@
-#include <cinttypes>
-#include <cstdio>
+#include <cstring>
 
 #include <stdexcept>
 #include <tuple>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include <libndgpp/error.hpp>
 #include <libndgpp/net/ipv4_array.hpp>
@@ -10,17 +14,9 @@
 
 std::string ndgpp::net::to_string(const ndgpp::net::ipv4_array value)
 {
-    // 3 characters per byte, 3 period characters, and 1 null terminator
-    std::array<char, (std::tuple_size<ndgpp::net::ipv4_array>::value * 3) + 3 + 1> buffer;
-    const int bytes_written = std::snprintf(buffer.data(),
-                                            buffer.size(),
-                                            "%" PRIu32 "." "%" PRIu32 "." "%" PRIu32 "." "%" PRIu32,
-                                            value[0],
-                                            value[1],
-                                            value[2],
-                                            value[3]);
-
-    return std::string{buffer.begin(), buffer.begin() + bytes_written};
+    std::array<char, ndgpp::net::ipv4_max_chars> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    return std::string{buffer.data(), result.ptr};
 }
 
 ndgpp::net::ipv4_array ndgpp::net::make_ipv4_array(const std::string & address)
@@ -56,3 +52,287 @@ ndgpp::net::ipv4_array ndgpp::net::make_ipv4_array(const std::string & address)
 
     return octets;
 }
+
+namespace
+{
+    inline bool is_digit(const char c) noexcept
+    {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    /// Parses an address one character at a time, and reports the exact error
+    ndgpp::net::ipv4_parse_result parse_ipv4_array_scalar(char const * const first, char const * const last) noexcept
+    {
+        ndgpp::net::ipv4_array octets;
+        char const * position = first;
+        for (std::size_t i = 0; i < octets.size(); ++i)
+        {
+            if (i != 0)
+            {
+                if (position == last || *position != '.')
+                {
+                    return {ndgpp::net::ipv4_parse_errc::expected_dot, position};
+                }
+
+                ++position;
+            }
+
+            // One digit more than an octet can have is consumed to
+            // detect octets that are too long
+            char const * const start = position;
+            unsigned int value = 0;
+            while (position != last && is_digit(*position) && position - start < 4)
+            {
+                value = value * 10 + static_cast<unsigned int>(*position - '0');
+                ++position;
+            }
+
+            if (position == start)
+            {
+                return {ndgpp::net::ipv4_parse_errc::expected_digit, position};
+            }
+
+            if (position - start > 3)
+            {
+                return {ndgpp::net::ipv4_parse_errc::octet_too_long, start};
+            }
+
+            if (value > 255)
+            {
+                return {ndgpp::net::ipv4_parse_errc::octet_out_of_range, start};
+            }
+
+            octets[i] = static_cast<uint8_t>(value);
+        }
+
+        return {octets, position};
+    }
+
+#if defined(__SSE2__)
+    /// Returns the value of the one to three digits at digits[0, size)
+    inline unsigned int octet_value(uint8_t const * const digits, const unsigned int size) noexcept
+    {
+        // The conditions compile to conditional moves
+        unsigned int value = digits[0];
+        value = size > 1 ? value * 10 + digits[1] : value;
+        value = size > 2 ? value * 10 + digits[2] : value;
+        return value;
+    }
+
+    /** Parses a valid address with one 16 byte load
+     *
+     *  Returns false if the address is not valid, so the scalar
+     *  parser can report the error.
+     */
+    bool parse_ipv4_array_sse2(char const * const first,
+                               char const * const last,
+                               ndgpp::net::ipv4_array & octets,
+                               char const * & end) noexcept
+    {
+        __m128i input;
+        if (last - first >= 16)
+        {
+            input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+        }
+        else
+        {
+            // The padding is neither a digit nor a period, so it ends the address
+            alignas(16) char buffer[16] = {};
+            if (first != last)
+            {
+                std::memcpy(buffer, first, static_cast<std::size_t>(last - first));
+            }
+
+            input = _mm_load_si128(reinterpret_cast<__m128i const *>(buffer));
+        }
+
+        // Characters below '0' or above 0x7f become negative
+        const __m128i values = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+        const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(values, _mm_set1_epi8(-1)),
+                                             _mm_cmplt_epi8(values, _mm_set1_epi8(10)));
+        const __m128i dots = _mm_cmpeq_epi8(input, _mm_set1_epi8('.'));
+
+        const uint32_t digit_mask = static_cast<uint32_t>(_mm_movemask_epi8(digits));
+        const uint32_t dot_mask = static_cast<uint32_t>(_mm_movemask_epi8(dots));
+
+        uint32_t remaining_dots = dot_mask;
+        if (remaining_dots == 0)
+        {
+            return false;
+        }
+
+        const unsigned int dot1 = static_cast<unsigned int>(__builtin_ctz(remaining_dots));
+        remaining_dots &= remaining_dots - 1;
+        if (remaining_dots == 0)
+        {
+            return false;
+        }
+
+        const unsigned int dot2 = static_cast<unsigned int>(__builtin_ctz(remaining_dots));
+        remaining_dots &= remaining_dots - 1;
+        if (remaining_dots == 0)
+        {
+            return false;
+        }
+
+        const unsigned int dot3 = static_cast<unsigned int>(__builtin_ctz(remaining_dots));
+
+        // The upper 16 bits of the inverted mask are set, so the
+        // fourth octet ends inside of the inverted mask
+        const unsigned int size4 = static_cast<unsigned int>(__builtin_ctz(~digit_mask >> (dot3 + 1)));
+        const unsigned int size1 = dot1;
+        const unsigned int size2 = dot2 - dot1 - 1;
+        const unsigned int size3 = dot3 - dot2 - 1;
+
+        // Every character before the third period is a digit or a
+        // period, and every octet has one to three digits
+        const uint32_t prefix = (uint32_t {1} << dot3) - 1;
+        const bool valid = (((digit_mask | dot_mask) & prefix) == prefix) &
+                           ((size1 - 1) < 3) & ((size2 - 1) < 3) & ((size3 - 1) < 3) & ((size4 - 1) < 3);
+        if (!valid)
+        {
+            return false;
+        }
+
+        // The fourth octet ends before the last byte, because three
+        // octets and three periods take at most twelve bytes
+        alignas(16) uint8_t digit_values[16];
+        _mm_store_si128(reinterpret_cast<__m128i *>(digit_values), values);
+
+        const unsigned int value1 = octet_value(digit_values, size1);
+        const unsigned int value2 = octet_value(digit_values + dot1 + 1, size2);
+        const unsigned int value3 = octet_value(digit_values + dot2 + 1, size3);
+        const unsigned int value4 = octet_value(digit_values + dot3 + 1, size4);
+        if ((value1 | value2 | value3 | value4) > 255)
+        {
+            return false;
+        }
+
+        octets = {{static_cast<uint8_t>(value1),
+                   static_cast<uint8_t>(value2),
+                   static_cast<uint8_t>(value3),
+                   static_cast<uint8_t>(value4)}};
+        end = first + dot3 + 1 + size4;
+        return true;
+    }
+#endif
+}
+
+ndgpp::net::ipv4_parse_result ndgpp::net::parse_ipv4_array(char const * const first, char const * const last) noexcept
+{
+#if defined(__SSE2__)
+    ndgpp::net::ipv4_array octets;
+    char const * end;
+    if (parse_ipv4_array_sse2(first, last, octets, end))
+    {
+        return {octets, end};
+    }
+#endif
+
+    return parse_ipv4_array_scalar(first, last);
+}
+
+namespace
+{
+    /** The text of an octet
+     *
+     *  The digits are followed by the number of digits, so an entry
+     *  is copied with one four byte store and the output is advanced
+     *  by the last byte.
+     */
+    using octet_text = std::array<char, 4>;
+
+    constexpr octet_text make_octet_text(const unsigned int octet) noexcept
+    {
+        return octet >= 100 ? octet_text {{static_cast<char>('0' + octet / 100),
+                                           static_cast<char>('0' + octet / 10 % 10),
+                                           static_cast<char>('0' + octet % 10),
+                                           3}} :
+               octet >= 10 ? octet_text {{static_cast<char>('0' + octet / 10),
+                                          static_cast<char>('0' + octet % 10),
+                                          0,
+                                          2}} :
+               octet_text {{static_cast<char>('0' + octet), 0, 0, 1}};
+    }
+
+    template <std::size_t ... Is>
+    constexpr std::array<octet_text, sizeof...(Is)> make_octet_texts(std::index_sequence<Is...>) noexcept
+    {
+        return {{make_octet_text(Is)...}};
+    }
+
+    constexpr std::array<octet_text, 256> octet_texts = make_octet_texts(std::make_index_sequence<256> {});
+
+    /** Writes an address without checking the buffer's size
+     *
+     *  Each octet's table entry is copied whole, so up to one byte
+     *  past the address is overwritten and the buffer must have
+     *  ipv4_max_chars + 1 bytes.
+     */
+    inline char * write_ipv4_unchecked(char * position, const ndgpp::net::ipv4_array value) noexcept
+    {
+        for (std::size_t i = 0; i < value.size(); ++i)
+        {
+            const octet_text & text = octet_texts[value[i]];
+            std::memcpy(position, text.data(), text.size());
+            position += text[3];
+            *position = '.';
+            ++position;
+        }
+
+        // The last octet is not followed by a period
+        return position - 1;
+    }
+}
+
+ndgpp::to_chars_result ndgpp::net::to_chars(char * const first, char * const last, const ndgpp::net::ipv4_array value) noexcept
+{
+    const std::size_t size = static_cast<std::size_t>(last - first);
+    if (size > ndgpp::net::ipv4_max_chars)
+    {
+        return {write_ipv4_unchecked(first, value), std::errc {}};
+    }
+
+    std::array<char, ndgpp::net::ipv4_max_chars + 1> buffer;
+    const std::size_t written = static_cast<std::size_t>(write_ipv4_unchecked(buffer.data(), value) - buffer.data());
+    if (written > size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(first, buffer.data(), written);
+    return {first + written, std::errc {}};
+}
+
+ndgpp::to_chars_result ndgpp::net::to_chars(char * const first,
+                                            char * const last,
+                                            ndgpp::net::ipv4_array const * const values,
+                                            const std::size_t count,
+                                            const char separator) noexcept
+{
+    char * position = first;
+    std::size_t i = 0;
+
+    // An address, its separator and the byte written past them fit
+    for (; i < count && static_cast<std::size_t>(last - position) >= ndgpp::net::ipv4_max_chars + 2; ++i)
+    {
+        position = write_ipv4_unchecked(position, values[i]);
+        *position = separator;
+        ++position;
+    }
+
+    for (; i < count; ++i)
+    {
+        const ndgpp::to_chars_result result = ndgpp::net::to_chars(position, last, values[i]);
+        if (result.ec != std::errc {} || result.ptr == last)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        position = result.ptr;
+        *position = separator;
+        ++position;
+    }
+
+    return {position, std::errc {}};
+}
@@ -0,0 +1,137 @@
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/network_byte_order.hpp>
+#include <libndgpp/net/ipv4_array.hpp>
+#include <libndgpp/net/ipv4_endpoint.hpp>
+
+constexpr std::size_t ndgpp::net::ipv4_endpoint::max_chars;
+
+ndgpp::net::ipv4_endpoint::ipv4_endpoint(const std::string & value)
+{
+    char const * const last = value.data() + value.size();
+    const ndgpp::net::ipv4_endpoint_parse_result result = ndgpp::net::parse_ipv4_endpoint(value.data(), last);
+    if (!result || result.unparsed() != last)
+    {
+        throw ndgpp_error(std::invalid_argument, "invalid IPv4 endpoint");
+    }
+
+    *this = result.value();
+}
+
+ndgpp::net::ipv4_endpoint::ipv4_endpoint(const sockaddr_in & address)
+{
+    if (address.sin_family != AF_INET)
+    {
+        throw ndgpp_error(std::invalid_argument, "socket address family is not AF_INET");
+    }
+
+    this->value_ = (uint64_t {ndgpp::network_to_host(static_cast<uint32_t>(address.sin_addr.s_addr))} << 16 |
+                    ndgpp::network_to_host(static_cast<uint16_t>(address.sin_port)));
+}
+
+sockaddr_in ndgpp::net::ipv4_endpoint::to_sockaddr() const noexcept
+{
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    this->to_sockaddr(address);
+    return address;
+}
+
+void ndgpp::net::ipv4_endpoint::to_sockaddr(sockaddr_in & address) const noexcept
+{
+    address.sin_addr.s_addr = ndgpp::host_to_network(static_cast<uint32_t>(this->value_ >> 16));
+    address.sin_port = ndgpp::host_to_network(static_cast<uint16_t>(this->value_));
+}
+
+std::string ndgpp::net::ipv4_endpoint::to_string() const
+{
+    std::array<char, max_chars> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), *this);
+    return std::string {buffer.data(), result.ptr};
+}
+
+ndgpp::net::ipv4_endpoint_parse_result ndgpp::net::parse_ipv4_endpoint(char const * const first, char const * const last) noexcept
+{
+    const ndgpp::net::ipv4_parse_result address = ndgpp::net::parse_ipv4_array(first, last);
+    if (!address)
+    {
+        return {ndgpp::net::ipv4_endpoint_parse_errc::invalid_address, address.unparsed()};
+    }
+
+    char const * position = address.unparsed();
+    if (position == last || *position != ':')
+    {
+        return {ndgpp::net::ipv4_endpoint_parse_errc::expected_colon, position};
+    }
+
+    ++position;
+    char const * const port_first = position;
+    uint32_t port = 0;
+    while (position != last && static_cast<unsigned char>(*position - '0') < 10)
+    {
+        // Ports are at most five digits, so port cannot overflow
+        if (position - port_first == 5)
+        {
+            return {ndgpp::net::ipv4_endpoint_parse_errc::port_out_of_range, port_first};
+        }
+
+        port = port * 10 + static_cast<uint32_t>(*position - '0');
+        ++position;
+    }
+
+    if (position == port_first)
+    {
+        return {ndgpp::net::ipv4_endpoint_parse_errc::expected_digit, position};
+    }
+
+    if (port > 0xffff)
+    {
+        return {ndgpp::net::ipv4_endpoint_parse_errc::port_out_of_range, port_first};
+    }
+
+    return {ndgpp::net::ipv4_endpoint {ndgpp::net::ipv4_address {ndgpp::net::to_uint32(address.value())},
+                                       ndgpp::net::port {static_cast<uint16_t>(port)}},
+            position};
+}
+
+ndgpp::to_chars_result ndgpp::net::to_chars(char * const first, char * const last, const ndgpp::net::ipv4_endpoint endpoint) noexcept
+{
+    std::array<char, ndgpp::net::ipv4_endpoint::max_chars> buffer;
+    char * position = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), endpoint.address()).ptr;
+    *position++ = ':';
+
+    // The port's digits are written backwards and then copied after the colon
+    std::array<char, 5> digits;
+    std::size_t count = 0;
+    unsigned int port = static_cast<uint16_t>(endpoint.to_uint64());
+    do
+    {
+        digits[count++] = static_cast<char>('0' + port % 10);
+        port /= 10;
+    } while (port != 0);
+
+    while (count != 0)
+    {
+        *position++ = digits[--count];
+    }
+
+    const std::size_t size = static_cast<std::size_t>(position - buffer.data());
+    if (size > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(first, buffer.data(), size);
+    return {first + size, std::errc {}};
+}
+
+std::ostream & ndgpp::net::operator <<(std::ostream & stream, const ndgpp::net::ipv4_endpoint endpoint)
+{
+    std::array<char, ndgpp::net::ipv4_endpoint::max_chars> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), endpoint);
+    return stream.write(buffer.data(), result.ptr - buffer.data());
+}
@@ -0,0 +1,217 @@
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <libndgpp/net/ipv4_extract.hpp>
+
+namespace
+{
+    /// A run of digits and periods
+    struct candidate
+    {
+        char const * first;
+        char const * last;
+    };
+
+    /// The number of candidates located before they are parsed
+    constexpr std::size_t batch_size = 64;
+
+    constexpr std::size_t block_size = 16;
+
+    /// Returns a mask of the digits and periods in the block of size characters at data
+    inline uint32_t token_mask(char const * const data, const std::size_t size) noexcept
+    {
+#if defined(__SSE2__)
+        __m128i input;
+        if (size == block_size)
+        {
+            input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+        }
+        else
+        {
+            alignas(16) char buffer[block_size] = {};
+            std::memcpy(buffer, data, size);
+            input = _mm_load_si128(reinterpret_cast<__m128i const *>(buffer));
+        }
+
+        // Characters below '0' or above 0x7f become negative
+        const __m128i values = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+        const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(values, _mm_set1_epi8(-1)),
+                                             _mm_cmplt_epi8(values, _mm_set1_epi8(10)));
+        const __m128i dots = _mm_cmpeq_epi8(input, _mm_set1_epi8('.'));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(digits, dots)));
+#else
+        uint32_t mask = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const bool token = static_cast<unsigned char>(data[i] - '0') < 10 || data[i] == '.';
+            mask |= static_cast<uint32_t>(token) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+    /** Locates up to max runs of digits and periods
+     *
+     *  The character before position is treated as not being part of
+     *  a run.
+     *
+     *  @return The position scanning stopped at
+     */
+    char const * find_candidates(char const * position,
+                                 char const * const last,
+                                 candidate * const candidates,
+                                 const std::size_t max,
+                                 std::size_t & count) noexcept
+    {
+        count = 0;
+        char const * run_first = nullptr;
+        uint32_t in_run = 0;
+
+        while (position != last)
+        {
+            const std::size_t size = std::min(block_size, static_cast<std::size_t>(last - position));
+            const uint32_t mask = token_mask(position, size);
+
+            // A run starts where a token follows a non-token, and ends
+            // where a non-token follows a token
+            const uint32_t previous = (mask << 1) | in_run;
+            const uint32_t valid = (uint32_t {1} << size) - 1;
+            uint32_t events = (mask ^ previous) & valid;
+
+            while (events != 0)
+            {
+                const unsigned int bit = static_cast<unsigned int>(__builtin_ctz(events));
+                events &= events - 1;
+
+                if (mask & (uint32_t {1} << bit))
+                {
+                    run_first = position + bit;
+                }
+                else
+                {
+                    candidates[count] = candidate {run_first, position + bit};
+                    ++count;
+                    if (count == max)
+                    {
+                        return position + bit;
+                    }
+                }
+            }
+
+            in_run = (mask >> (size - 1)) & 1;
+            position += size;
+        }
+
+        if (in_run)
+        {
+            candidates[count] = candidate {run_first, last};
+            ++count;
+        }
+
+        return last;
+    }
+
+    /// Parses a candidate, returning false if it is not an address
+    inline bool parse_candidate(candidate run, ndgpp::net::ipv4_array & value) noexcept
+    {
+        while (run.first != run.last && *run.first == '.')
+        {
+            ++run.first;
+        }
+
+        // An address and a trailing period
+        if (static_cast<std::size_t>(run.last - run.first) > ndgpp::net::ipv4_max_chars + 1)
+        {
+            return false;
+        }
+
+        const ndgpp::net::ipv4_parse_result result = ndgpp::net::parse_ipv4_array(run.first, run.last);
+        if (!result)
+        {
+            return false;
+        }
+
+        const char * const end = result.unparsed();
+        if (end != run.last && !(end + 1 == run.last && *end == '.'))
+        {
+            return false;
+        }
+
+        value = result.value();
+        return true;
+    }
+
+    template <class T, class Convert>
+    ndgpp::net::ipv4_extract_result extract(char const * const first,
+                                            char const * const last,
+                                            T * const out,
+                                            const std::size_t capacity,
+                                            Convert convert) noexcept
+    {
+        std::array<candidate, batch_size> candidates;
+        std::size_t count = 0;
+        char const * position = first;
+
+        while (position != last && count != capacity)
+        {
+            std::size_t found;
+            const std::size_t max = std::min(batch_size, capacity - count);
+            const char * const scanned = find_candidates(position, last, candidates.data(), max, found);
+
+            for (std::size_t i = 0; i < found; ++i)
+            {
+                ndgpp::net::ipv4_array value;
+                if (parse_candidate(candidates[i], value))
+                {
+                    out[count] = convert(value);
+                    ++count;
+                    if (count == capacity)
+                    {
+                        return {count, candidates[i].last};
+                    }
+                }
+            }
+
+            position = scanned;
+        }
+
+        return {count, position};
+    }
+}
+
+ndgpp::net::ipv4_extract_result ndgpp::net::extract_ipv4_addresses(char const * const first,
+                                                                   char const * const last,
+                                                                   ndgpp::net::ipv4_array * const out,
+                                                                   const std::size_t capacity) noexcept
+{
+    return extract(first, last, out, capacity, [] (const ndgpp::net::ipv4_array value) {
+            return value;
+        });
+}
+
+ndgpp::net::ipv4_extract_result ndgpp::net::extract_ipv4_addresses(char const * const first,
+                                                                   char const * const last,
+                                                                   uint32_t * const out,
+                                                                   const std::size_t capacity) noexcept
+{
+    return extract(first, last, out, capacity, [] (const ndgpp::net::ipv4_array value) {
+            return ndgpp::net::to_uint32(value);
+        });
+}
+
+ndgpp::net::ipv4_extract_result ndgpp::net::extract_ipv4_addresses(char const * const first,
+                                                                   char const * const last,
+                                                                   ndgpp::net::ipv4_address * const out,
+                                                                   const std::size_t capacity) noexcept
+{
+    return extract(first, last, out, capacity, [] (const ndgpp::net::ipv4_array value) {
+            return ndgpp::net::ipv4_address {value};
+        });
+}
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_lpm_table.hpp>
+
+namespace
+{
+    constexpr std::size_t first_level_size = std::size_t {1} << 24;
+    constexpr std::size_t group_size = 256;
+
+    /// The number of addresses looked up ahead of the current one in a batch
+    constexpr std::size_t prefetch_distance = 16;
+
+    template <class Address, class ToUint32>
+    void batch_lookup(const ndgpp::net::ipv4_lpm_table & table,
+                      uint32_t const * const first_level,
+                      Address const * const addresses,
+                      const std::size_t count,
+                      uint32_t * const values,
+                      ToUint32 to_uint32) noexcept
+    {
+        const std::size_t warmup = std::min(count, prefetch_distance);
+        for (std::size_t i = 0; i < warmup; ++i)
+        {
+            __builtin_prefetch(first_level + (to_uint32(addresses[i]) >> 8));
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i + prefetch_distance < count)
+            {
+                __builtin_prefetch(first_level + (to_uint32(addresses[i + prefetch_distance]) >> 8));
+            }
+
+            values[i] = table.lookup(to_uint32(addresses[i]));
+        }
+    }
+}
+
+constexpr uint32_t ndgpp::net::ipv4_lpm_table::no_match;
+constexpr uint32_t ndgpp::net::ipv4_lpm_table::max_value;
+constexpr uint32_t ndgpp::net::ipv4_lpm_table::valid_flag;
+constexpr uint32_t ndgpp::net::ipv4_lpm_table::group_flag;
+constexpr uint32_t ndgpp::net::ipv4_lpm_table::value_mask;
+constexpr unsigned int ndgpp::net::ipv4_lpm_table::depth_shift;
+
+ndgpp::net::ipv4_lpm_table::ipv4_lpm_table():
+    first_level_(first_level_size, 0)
+{}
+
+ndgpp::net::ipv4_lpm_table::ipv4_lpm_table(ipv4_lpm_table &&) noexcept = default;
+ndgpp::net::ipv4_lpm_table & ndgpp::net::ipv4_lpm_table::operator = (ipv4_lpm_table &&) noexcept = default;
+ndgpp::net::ipv4_lpm_table::~ipv4_lpm_table() = default;
+
+void ndgpp::net::ipv4_lpm_table::insert(const ndgpp::net::ipv4_network network, const uint32_t value)
+{
+    if (value > max_value)
+    {
+        throw ndgpp_error(std::out_of_range, "ipv4_lpm_table value is greater than max_value");
+    }
+
+    const uint32_t address = network.network().to_uint32();
+    const unsigned int depth = network.prefix_length().value();
+    const uint32_t entry = make_entry(value, depth);
+
+    if (depth <= 24)
+    {
+        const std::size_t first = address >> 8;
+        this->fill(this->first_level_.data(), first, first + (std::size_t {1} << (24 - depth)), entry, depth);
+    }
+    else
+    {
+        const uint32_t index = address >> 8;
+        if (!(this->first_level_[index] & group_flag))
+        {
+            this->first_level_[index] = group_flag | this->allocate_group(this->first_level_[index]);
+        }
+
+        uint32_t * const group = this->second_level_.data() + (this->first_level_[index] & value_mask) * group_size;
+        const std::size_t first = address & 0xff;
+        this->fill(group, first, first + (std::size_t {1} << (32 - depth)), entry, depth);
+    }
+
+    this->prefixes_[network] = value;
+}
+
+bool ndgpp::net::ipv4_lpm_table::erase(const ndgpp::net::ipv4_network network)
+{
+    if (this->prefixes_.erase(network) == 0)
+    {
+        return false;
+    }
+
+    const uint32_t address = network.network().to_uint32();
+    const unsigned int depth = network.prefix_length().value();
+
+    // The addresses are now matched by the longest prefix that contains the erased one
+    uint32_t replacement = 0;
+    for (unsigned int length = depth; length-- > 0;)
+    {
+        const auto iter = this->prefixes_.find(network.supernet(ndgpp::net::ipv4_prefix_length {length}));
+        if (iter != this->prefixes_.end())
+        {
+            replacement = make_entry(iter->second, length);
+            break;
+        }
+    }
+
+    if (depth <= 24)
+    {
+        const std::size_t first = address >> 8;
+        this->replace(this->first_level_.data(), first, first + (std::size_t {1} << (24 - depth)), depth, replacement, true);
+    }
+    else
+    {
+        const uint32_t index = address >> 8;
+        uint32_t * const group = this->second_level_.data() + (this->first_level_[index] & value_mask) * group_size;
+        const std::size_t first = address & 0xff;
+        this->replace(group, first, first + (std::size_t {1} << (32 - depth)), depth, replacement, false);
+        this->collapse_group(index);
+    }
+
+    return true;
+}
+
+void ndgpp::net::ipv4_lpm_table::clear()
+{
+    std::fill(this->first_level_.begin(), this->first_level_.end(), 0);
+    this->second_level_.clear();
+    this->free_groups_.clear();
+    this->prefixes_.clear();
+}
+
+std::size_t ndgpp::net::ipv4_lpm_table::size() const noexcept
+{
+    return this->prefixes_.size();
+}
+
+void ndgpp::net::ipv4_lpm_table::lookup(uint32_t const * const addresses,
+                                        const std::size_t count,
+                                        uint32_t * const values) const noexcept
+{
+    batch_lookup(*this, this->first_level_.data(), addresses, count, values, [] (const uint32_t address) {
+            return address;
+        });
+}
+
+void ndgpp::net::ipv4_lpm_table::lookup(ndgpp::net::ipv4_address const * const addresses,
+                                        const std::size_t count,
+                                        uint32_t * const values) const noexcept
+{
+    batch_lookup(*this, this->first_level_.data(), addresses, count, values, [] (const ndgpp::net::ipv4_address address) {
+            return address.to_uint32();
+        });
+}
+
+void ndgpp::net::ipv4_lpm_table::fill(uint32_t * const entries,
+                                      const std::size_t first,
+                                      const std::size_t last,
+                                      const uint32_t entry,
+                                      const unsigned int depth) noexcept
+{
+    for (std::size_t i = first; i < last; ++i)
+    {
+        const uint32_t current = entries[i];
+        if (current & group_flag)
+        {
+            uint32_t * const group = this->second_level_.data() + (current & value_mask) * group_size;
+            this->fill(group, 0, group_size, entry, depth);
+        }
+        else if (!(current & valid_flag) || entry_depth(current) <= depth)
+        {
+            entries[i] = entry;
+        }
+    }
+}
+
+void ndgpp::net::ipv4_lpm_table::replace(uint32_t * const entries,
+                                         const std::size_t first,
+                                         const std::size_t last,
+                                         const unsigned int depth,
+                                         const uint32_t replacement,
+                                         const bool first_level) noexcept
+{
+    for (std::size_t i = first; i < last; ++i)
+    {
+        const uint32_t current = entries[i];
+        if (first_level && (current & group_flag))
+        {
+            uint32_t * const group = this->second_level_.data() + (current & value_mask) * group_size;
+            this->replace(group, 0, group_size, depth, replacement, false);
+            this->collapse_group(static_cast<uint32_t>(i));
+        }
+        else if ((current & valid_flag) && entry_depth(current) == depth)
+        {
+            entries[i] = replacement;
+        }
+    }
+}
+
+uint32_t ndgpp::net::ipv4_lpm_table::allocate_group(const uint32_t entry)
+{
+    uint32_t group;
+    if (this->free_groups_.empty())
+    {
+        group = static_cast<uint32_t>(this->second_level_.size() / group_size);
+        this->second_level_.resize(this->second_level_.size() + group_size);
+    }
+    else
+    {
+        group = this->free_groups_.back();
+        this->free_groups_.pop_back();
+    }
+
+    // The group starts out matching what the first level entry matched
+    std::fill_n(this->second_level_.begin() + group * group_size, group_size, entry);
+    return group;
+}
+
+void ndgpp::net::ipv4_lpm_table::collapse_group(const uint32_t index) noexcept
+{
+    const uint32_t group = this->first_level_[index] & value_mask;
+    uint32_t const * const entries = this->second_level_.data() + group * group_size;
+
+    // A group can only be collapsed if no entry has a prefix longer than 24 bits
+    const uint32_t entry = entries[0];
+    const bool uniform = std::all_of(entries, entries + group_size, [entry] (const uint32_t e) {return e == entry;});
+    if (uniform && (!(entry & valid_flag) || entry_depth(entry) <= 24))
+    {
+        this->first_level_[index] = entry;
+        this->free_groups_.push_back(group);
+    }
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_array.hpp>
+#include <libndgpp/net/ipv4_network.hpp>
+
+constexpr std::size_t ndgpp::net::ipv4_network::max_chars;
+
+ndgpp::net::ipv4_network::ipv4_network(const std::string & value)
+{
+    char const * const first = value.data();
+    char const * const last = first + value.size();
+    char const * const slash = std::find(first, last, '/');
+    if (slash == last)
+    {
+        throw ndgpp_error(std::invalid_argument, "network does not have a prefix length");
+    }
+
+    // The address must end exactly at the slash
+    const ndgpp::net::ipv4_parse_result address = ndgpp::net::parse_ipv4_array(first, slash);
+    if (!address || address.unparsed() != slash)
+    {
+        throw ndgpp_error(std::invalid_argument, "invalid network address");
+    }
+
+    // The prefix length is one or two digits that end the string
+    char const * const digits = slash + 1;
+    const std::ptrdiff_t digit_count = last - digits;
+    if (digit_count < 1 || digit_count > 2 ||
+        !std::all_of(digits, last, [] (const char c) { return c >= '0' && c <= '9'; }))
+    {
+        throw ndgpp::error<ndgpp::bounded_integer_invalid>(ndgpp_source_location);
+    }
+
+    unsigned int prefix_length = 0;
+    for (char const * position = digits; position != last; ++position)
+    {
+        prefix_length = prefix_length * 10 + static_cast<unsigned int>(*position - '0');
+    }
+
+    *this = ipv4_network {address_type {address.value()}, prefix_length_type {prefix_length}};
+}
+
+std::string ndgpp::net::ipv4_network::to_string() const
+{
+    std::array<char, max_chars> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), *this);
+    return std::string {buffer.data(), result.ptr};
+}
+
+ndgpp::to_chars_result ndgpp::net::to_chars(char * const first, char * const last, const ndgpp::net::ipv4_network network) noexcept
+{
+    std::array<char, ndgpp::net::ipv4_network::max_chars> buffer;
+    char * position = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), network.network()).ptr;
+
+    const unsigned int prefix_length = network.prefix_length().value();
+    *position++ = '/';
+    if (prefix_length >= 10)
+    {
+        *position++ = static_cast<char>('0' + prefix_length / 10);
+    }
+
+    *position++ = static_cast<char>('0' + prefix_length % 10);
+
+    const std::size_t size = static_cast<std::size_t>(position - buffer.data());
+    if (size > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(first, buffer.data(), size);
+    return {first + size, std::errc {}};
+}
+
+std::ostream & ndgpp::net::operator <<(std::ostream & stream, const ndgpp::net::ipv4_network network)
+{
+    std::array<char, ndgpp::net::ipv4_network::max_chars> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), network);
+    return stream.write(buffer.data(), result.ptr - buffer.data());
+}
@@ -0,0 +1,379 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_range_set.hpp>
+
+namespace
+{
+    void validate(const ndgpp::net::ipv4_range range)
+    {
+        if (range.first > range.last)
+        {
+            throw ndgpp_error(std::invalid_argument, "ipv4_range first address is greater than its last address");
+        }
+    }
+
+    /// Returns true if the address after lhs.last is at or past rhs.first
+    bool touches(const ndgpp::net::ipv4_range lhs, const ndgpp::net::ipv4_range rhs) noexcept
+    {
+        return uint64_t {lhs.last} + 1 >= rhs.first;
+    }
+
+    /** Appends range to ranges, merging it with the last range if they overlap or are adjacent
+     *
+     *  The ranges must be appended in order of their first address.
+     */
+    void append(std::vector<ndgpp::net::ipv4_range> & ranges, const ndgpp::net::ipv4_range range)
+    {
+        if (!ranges.empty() && touches(ranges.back(), range))
+        {
+            ranges.back().last = std::max(ranges.back().last, range.last);
+        }
+        else
+        {
+            ranges.push_back(range);
+        }
+    }
+
+    std::vector<ndgpp::net::ipv4_range> unite(const std::vector<ndgpp::net::ipv4_range> & lhs,
+                                              const std::vector<ndgpp::net::ipv4_range> & rhs)
+    {
+        std::vector<ndgpp::net::ipv4_range> ranges;
+        ranges.reserve(lhs.size() + rhs.size());
+
+        auto lhs_iter = lhs.begin();
+        auto rhs_iter = rhs.begin();
+        while (lhs_iter != lhs.end() || rhs_iter != rhs.end())
+        {
+            if (rhs_iter == rhs.end() || (lhs_iter != lhs.end() && lhs_iter->first < rhs_iter->first))
+            {
+                append(ranges, *lhs_iter++);
+            }
+            else
+            {
+                append(ranges, *rhs_iter++);
+            }
+        }
+
+        return ranges;
+    }
+
+    /// Builds the Eytzinger layout of the subtree rooted at index from the sorted ranges starting at position
+    std::size_t build_subtree(const std::vector<ndgpp::net::ipv4_range> & ranges,
+                              std::vector<ndgpp::net::ipv4_range> & layout,
+                              std::size_t position,
+                              const std::size_t index)
+    {
+        if (index <= ranges.size())
+        {
+            position = build_subtree(ranges, layout, position, 2 * index);
+            layout[index] = ranges[position++];
+            position = build_subtree(ranges, layout, position, 2 * index + 1);
+        }
+
+        return position;
+    }
+
+    /// The number of searches interleaved by the batched membership test
+    constexpr std::size_t batch_size = 8;
+
+    template <class Address, class ToUint32>
+    void batch_contains(ndgpp::net::ipv4_range const * const layout,
+                        const std::size_t size,
+                        Address const * const addresses,
+                        const std::size_t count,
+                        bool * const results,
+                        ToUint32 to_uint32) noexcept
+    {
+        for (std::size_t base = 0; base < count; base += batch_size)
+        {
+            const std::size_t lanes = std::min(batch_size, count - base);
+
+            uint32_t values[batch_size];
+            std::size_t indexes[batch_size];
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                values[lane] = to_uint32(addresses[base + lane]);
+                indexes[lane] = 1;
+            }
+
+            // Searches differ in depth by at most one level, so
+            // advancing them in lock step keeps every lane busy
+            bool active = true;
+            while (active)
+            {
+                active = false;
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    const std::size_t index = indexes[lane];
+                    if (index <= size)
+                    {
+                        __builtin_prefetch(layout + index * 8);
+                        indexes[lane] = 2 * index + (layout[index].last < values[lane]);
+                        active = true;
+                    }
+                }
+            }
+
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                const std::size_t index = indexes[lane] >> __builtin_ffsll(static_cast<long long>(~indexes[lane]));
+                results[base + lane] = index != 0 && layout[index].first <= values[lane];
+            }
+        }
+    }
+}
+
+namespace ndgpp {
+namespace net {
+
+    ipv4_range_set::ipv4_range_set() = default;
+
+    ipv4_range_set::ipv4_range_set(ipv4_range const * const ranges, const std::size_t count)
+    {
+        this->insert(ranges, count);
+    }
+
+    void ipv4_range_set::insert(const ipv4_range range)
+    {
+        validate(range);
+
+        // The ranges that overlap or are adjacent to range are merged into it
+        const auto first = std::lower_bound(this->ranges_.begin(), this->ranges_.end(), range,
+                                            [] (const ipv4_range lhs, const ipv4_range rhs) {
+                                                return !touches(lhs, rhs);
+                                            });
+
+        auto last = first;
+        ipv4_range merged = range;
+        while (last != this->ranges_.end() && touches(merged, *last))
+        {
+            merged.first = std::min(merged.first, last->first);
+            merged.last = std::max(merged.last, last->last);
+            ++last;
+        }
+
+        if (first == last)
+        {
+            this->ranges_.insert(first, merged);
+        }
+        else
+        {
+            *first = merged;
+            this->ranges_.erase(first + 1, last);
+        }
+
+        this->build_layout();
+    }
+
+    void ipv4_range_set::insert(const ndgpp::net::ipv4_network network)
+    {
+        this->insert(ipv4_range {network});
+    }
+
+    void ipv4_range_set::insert(const ndgpp::net::ipv4_address address)
+    {
+        this->insert(ipv4_range {address});
+    }
+
+    void ipv4_range_set::insert(ipv4_range const * const ranges, const std::size_t count)
+    {
+        std::vector<ipv4_range> sorted {ranges, ranges + count};
+        std::for_each(sorted.begin(), sorted.end(), validate);
+        std::sort(sorted.begin(), sorted.end(), [] (const ipv4_range lhs, const ipv4_range rhs) {
+                return lhs.first < rhs.first;
+            });
+
+        std::vector<ipv4_range> coalesced;
+        coalesced.reserve(sorted.size());
+        for (const ipv4_range range: sorted)
+        {
+            append(coalesced, range);
+        }
+
+        this->ranges_ = unite(this->ranges_, coalesced);
+        this->build_layout();
+    }
+
+    void ipv4_range_set::erase(const ipv4_range range)
+    {
+        validate(range);
+
+        const auto first = std::lower_bound(this->ranges_.begin(), this->ranges_.end(), range,
+                                            [] (const ipv4_range lhs, const ipv4_range rhs) {
+                                                return lhs.last < rhs.first;
+                                            });
+
+        auto last = first;
+        while (last != this->ranges_.end() && last->first <= range.last)
+        {
+            ++last;
+        }
+
+        if (first == last)
+        {
+            return;
+        }
+
+        // Only the first and last overlapping ranges can extend past range
+        ipv4_range pieces[2];
+        std::size_t piece_count = 0;
+        if (first->first < range.first)
+        {
+            pieces[piece_count++] = ipv4_range {first->first, range.first - 1};
+        }
+
+        if ((last - 1)->last > range.last)
+        {
+            pieces[piece_count++] = ipv4_range {range.last + 1, (last - 1)->last};
+        }
+
+        const auto position = this->ranges_.erase(first, last);
+        this->ranges_.insert(position, pieces, pieces + piece_count);
+        this->build_layout();
+    }
+
+    void ipv4_range_set::erase(const ndgpp::net::ipv4_network network)
+    {
+        this->erase(ipv4_range {network});
+    }
+
+    void ipv4_range_set::erase(const ndgpp::net::ipv4_address address)
+    {
+        this->erase(ipv4_range {address});
+    }
+
+    void ipv4_range_set::clear() noexcept
+    {
+        this->ranges_.clear();
+        this->layout_.clear();
+    }
+
+    bool ipv4_range_set::contains(const ipv4_range range) const noexcept
+    {
+        if (range.first > range.last)
+        {
+            return false;
+        }
+
+        const std::size_t index = this->search(range.first);
+        return index != 0 && this->layout_[index].first <= range.first && range.last <= this->layout_[index].last;
+    }
+
+    void ipv4_range_set::contains(uint32_t const * const addresses, const std::size_t count, bool * const results) const noexcept
+    {
+        batch_contains(this->layout_.data(), this->ranges_.size(), addresses, count, results,
+                       [] (const uint32_t address) { return address; });
+    }
+
+    void ipv4_range_set::contains(ndgpp::net::ipv4_address const * const addresses, const std::size_t count, bool * const results) const noexcept
+    {
+        batch_contains(this->layout_.data(), this->ranges_.size(), addresses, count, results,
+                       [] (const ndgpp::net::ipv4_address address) { return address.to_uint32(); });
+    }
+
+    uint64_t ipv4_range_set::address_count() const noexcept
+    {
+        uint64_t count = 0;
+        for (const ipv4_range range: this->ranges_)
+        {
+            count += range.size();
+        }
+
+        return count;
+    }
+
+    void ipv4_range_set::build_layout()
+    {
+        this->layout_.resize(this->ranges_.size() + 1);
+        build_subtree(this->ranges_, this->layout_, 0, 1);
+    }
+
+    ipv4_range_set set_union(const ipv4_range_set & lhs, const ipv4_range_set & rhs)
+    {
+        ipv4_range_set result;
+        result.ranges_ = unite(lhs.ranges_, rhs.ranges_);
+        result.build_layout();
+        return result;
+    }
+
+    ipv4_range_set set_intersection(const ipv4_range_set & lhs, const ipv4_range_set & rhs)
+    {
+        ipv4_range_set result;
+        auto lhs_iter = lhs.ranges_.begin();
+        auto rhs_iter = rhs.ranges_.begin();
+        while (lhs_iter != lhs.ranges_.end() && rhs_iter != rhs.ranges_.end())
+        {
+            const uint32_t first = std::max(lhs_iter->first, rhs_iter->first);
+            const uint32_t last = std::min(lhs_iter->last, rhs_iter->last);
+            if (first <= last)
+            {
+                result.ranges_.push_back(ipv4_range {first, last});
+            }
+
+            // The range that ends first cannot overlap anything else in the other set
+            if (lhs_iter->last < rhs_iter->last)
+            {
+                ++lhs_iter;
+            }
+            else
+            {
+                ++rhs_iter;
+            }
+        }
+
+        result.build_layout();
+        return result;
+    }
+
+    ipv4_range_set set_difference(const ipv4_range_set & lhs, const ipv4_range_set & rhs)
+    {
+        ipv4_range_set result;
+        auto rhs_iter = rhs.ranges_.begin();
+        for (const ipv4_range range: lhs.ranges_)
+        {
+            while (rhs_iter != rhs.ranges_.end() && rhs_iter->last < range.first)
+            {
+                ++rhs_iter;
+            }
+
+            // The start of the part of range that has not been subtracted yet
+            uint64_t first = range.first;
+            while (rhs_iter != rhs.ranges_.end() && rhs_iter->first <= range.last)
+            {
+                if (rhs_iter->first > first)
+                {
+                    result.ranges_.push_back(ipv4_range {static_cast<uint32_t>(first), rhs_iter->first - 1});
+                }
+
+                first = uint64_t {rhs_iter->last} + 1;
+                if (rhs_iter->last >= range.last)
+                {
+                    // The rhs range may overlap the next lhs range too
+                    break;
+                }
+
+                ++rhs_iter;
+            }
+
+            if (first <= range.last)
+            {
+                result.ranges_.push_back(ipv4_range {static_cast<uint32_t>(first), range.last});
+            }
+        }
+
+        result.build_layout();
+        return result;
+    }
+
+    bool operator ==(const ipv4_range_set & lhs, const ipv4_range_set & rhs) noexcept
+    {
+        return lhs.ranges() == rhs.ranges();
+    }
+
+    bool operator !=(const ipv4_range_set & lhs, const ipv4_range_set & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+}}
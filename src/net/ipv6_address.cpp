@@ -0,0 +1,3 @@
+#include <libndgpp/net/ipv6_address.hpp>
+
+template class ndgpp::net::basic_ipv6_address<>;
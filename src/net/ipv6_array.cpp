@@ -0,0 +1,279 @@
+#include <cstring>
+
+#include <stdexcept>
+#include <utility>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_array.hpp>
+#include <libndgpp/net/ipv6_array.hpp>
+
+namespace
+{
+    /// The value of a hexadecimal digit, or 0xff if c is not one
+    constexpr uint8_t make_hex_value(const unsigned int c) noexcept
+    {
+        return c >= '0' && c <= '9' ? static_cast<uint8_t>(c - '0') :
+               c >= 'a' && c <= 'f' ? static_cast<uint8_t>(c - 'a' + 10) :
+               c >= 'A' && c <= 'F' ? static_cast<uint8_t>(c - 'A' + 10) :
+               0xff;
+    }
+
+    template <std::size_t ... Is>
+    constexpr std::array<uint8_t, sizeof...(Is)> make_hex_values(std::index_sequence<Is...>) noexcept
+    {
+        return {{make_hex_value(Is)...}};
+    }
+
+    constexpr std::array<uint8_t, 256> hex_values = make_hex_values(std::make_index_sequence<256> {});
+
+    inline unsigned int hex_value(const char c) noexcept
+    {
+        return hex_values[static_cast<unsigned char>(c)];
+    }
+
+    inline bool is_hex_digit(const char c) noexcept
+    {
+        return hex_value(c) < 16;
+    }
+}
+
+std::string ndgpp::net::to_string(const ndgpp::net::ipv6_array value)
+{
+    std::array<char, ndgpp::net::ipv6_max_chars> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    return std::string{buffer.data(), result.ptr};
+}
+
+ndgpp::net::ipv6_array ndgpp::net::make_ipv6_array(const std::string & address)
+{
+    char const * const last = address.data() + address.size();
+    const ndgpp::net::ipv6_parse_result result = ndgpp::net::parse_ipv6_array(address.data(), last);
+    if (!result || result.unparsed() != last)
+    {
+        throw ndgpp_error(std::invalid_argument, "invalid IPv6 address");
+    }
+
+    return result.value();
+}
+
+ndgpp::net::ipv6_parse_result ndgpp::net::parse_ipv6_array(char const * const first, char const * const last) noexcept
+{
+    std::array<uint16_t, 8> groups;
+    std::size_t count = 0;
+
+    // The index of the group the :: is in front of
+    std::size_t compression = groups.size();
+    char const * position = first;
+
+    if (position != last && *position == ':')
+    {
+        if (last - position < 2 || position[1] != ':')
+        {
+            return {ndgpp::net::ipv6_parse_errc::expected_digit, position};
+        }
+
+        compression = 0;
+        position += 2;
+    }
+
+    // The address ends after a :: that is not followed by a group
+    bool more = compression != 0 || (position != last && is_hex_digit(*position));
+    while (more)
+    {
+        char const * const group_first = position;
+        unsigned int group = 0;
+        while (position != last && position - group_first < 4 && is_hex_digit(*position))
+        {
+            group = group << 4 | hex_value(*position);
+            ++position;
+        }
+
+        if (position == group_first)
+        {
+            return {ndgpp::net::ipv6_parse_errc::expected_digit, position};
+        }
+
+        if (position != last && *position == '.')
+        {
+            // The group is the first octet of an embedded dotted quad
+            if (count > groups.size() - 2)
+            {
+                return {ndgpp::net::ipv6_parse_errc::too_many_groups, group_first};
+            }
+
+            const ndgpp::net::ipv4_parse_result ipv4 = ndgpp::net::parse_ipv4_array(group_first, last);
+            if (!ipv4)
+            {
+                return {ndgpp::net::ipv6_parse_errc::invalid_ipv4, group_first};
+            }
+
+            const ndgpp::net::ipv4_array octets = ipv4.value();
+            groups[count++] = static_cast<uint16_t>(octets[0] << 8 | octets[1]);
+            groups[count++] = static_cast<uint16_t>(octets[2] << 8 | octets[3]);
+            position = ipv4.unparsed();
+            break;
+        }
+
+        if (position != last && is_hex_digit(*position))
+        {
+            return {ndgpp::net::ipv6_parse_errc::group_too_long, position};
+        }
+
+        if (count == groups.size())
+        {
+            return {ndgpp::net::ipv6_parse_errc::too_many_groups, group_first};
+        }
+
+        groups[count++] = static_cast<uint16_t>(group);
+        if (position == last || *position != ':')
+        {
+            break;
+        }
+
+        if (last - position >= 2 && position[1] == ':')
+        {
+            if (compression != groups.size())
+            {
+                return {ndgpp::net::ipv6_parse_errc::multiple_compressions, position};
+            }
+
+            // A :: after the eighth group has no zero groups to stand
+            // for, and compression would equal the no :: marker
+            if (count == groups.size())
+            {
+                return {ndgpp::net::ipv6_parse_errc::too_many_groups, position};
+            }
+
+            compression = count;
+            position += 2;
+            more = position != last && is_hex_digit(*position);
+        }
+        else
+        {
+            ++position;
+        }
+    }
+
+    if (compression == groups.size() && count < groups.size())
+    {
+        return {ndgpp::net::ipv6_parse_errc::too_few_groups, position};
+    }
+
+    // A :: stands for at least one zero group
+    if (compression != groups.size() && count == groups.size())
+    {
+        return {ndgpp::net::ipv6_parse_errc::too_many_groups, position};
+    }
+
+    ndgpp::net::ipv6_array value {};
+    const std::size_t gap = groups.size() - count;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t index = i < compression ? i : i + gap;
+        value[2 * index] = static_cast<uint8_t>(groups[i] >> 8);
+        value[2 * index + 1] = static_cast<uint8_t>(groups[i]);
+    }
+
+    return {value, position};
+}
+
+namespace
+{
+    inline char * write_group(char * position, const unsigned int group) noexcept
+    {
+        static constexpr char digits[] = "0123456789abcdef";
+
+        // Leading zeros are not written
+        int shift = group >= 0x1000 ? 12 : group >= 0x100 ? 8 : group >= 0x10 ? 4 : 0;
+        for (; shift >= 0; shift -= 4)
+        {
+            *position = digits[(group >> shift) & 0xf];
+            ++position;
+        }
+
+        return position;
+    }
+
+    /// Writes an address without checking the buffer's size, which must have ipv6_max_chars bytes
+    char * write_ipv6_unchecked(char * position, const ndgpp::net::ipv6_array value) noexcept
+    {
+        std::array<unsigned int, 8> groups;
+        for (std::size_t i = 0; i < groups.size(); ++i)
+        {
+            groups[i] = static_cast<unsigned int>(value[2 * i]) << 8 | value[2 * i + 1];
+        }
+
+        if (ndgpp::net::ipv6_high(value) == 0 && groups[4] == 0 && groups[5] == 0xffff)
+        {
+            static constexpr char prefix[] = "::ffff:";
+            std::memcpy(position, prefix, sizeof(prefix) - 1);
+            position += sizeof(prefix) - 1;
+
+            const ndgpp::net::ipv4_array ipv4 {{value[12], value[13], value[14], value[15]}};
+            return ndgpp::net::to_chars(position, position + ndgpp::net::ipv4_max_chars, ipv4).ptr;
+        }
+
+        // Find the first of the longest runs of zero groups
+        std::size_t zeros_first = groups.size();
+        std::size_t zeros_size = 0;
+        std::size_t run_size = 0;
+        for (std::size_t i = 0; i < groups.size(); ++i)
+        {
+            run_size = groups[i] == 0 ? run_size + 1 : 0;
+            if (run_size > zeros_size)
+            {
+                zeros_size = run_size;
+                zeros_first = i + 1 - run_size;
+            }
+        }
+
+        // A single zero group is written as 0
+        if (zeros_size < 2)
+        {
+            zeros_first = groups.size();
+            zeros_size = 0;
+        }
+
+        for (std::size_t i = 0; i < groups.size();)
+        {
+            if (i == zeros_first)
+            {
+                position[0] = ':';
+                position[1] = ':';
+                position += 2;
+                i += zeros_size;
+                continue;
+            }
+
+            if (i != 0 && i != zeros_first + zeros_size)
+            {
+                *position = ':';
+                ++position;
+            }
+
+            position = write_group(position, groups[i]);
+            ++i;
+        }
+
+        return position;
+    }
+}
+
+ndgpp::to_chars_result ndgpp::net::to_chars(char * const first, char * const last, const ndgpp::net::ipv6_array value) noexcept
+{
+    const std::size_t size = static_cast<std::size_t>(last - first);
+    if (size >= ndgpp::net::ipv6_max_chars)
+    {
+        return {write_ipv6_unchecked(first, value), std::errc {}};
+    }
+
+    std::array<char, ndgpp::net::ipv6_max_chars> buffer;
+    const std::size_t written = static_cast<std::size_t>(write_ipv6_unchecked(buffer.data(), value) - buffer.data());
+    if (written > size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(first, buffer.data(), written);
+    return {first + written, std::errc {}};
+}
@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv6_lpm_table.hpp>
+
+namespace
+{
+    /// The number of trie walks interleaved by the batched lookup
+    constexpr std::size_t batch_size = 8;
+
+    /// Clears the bits of an address after prefix_length
+    void mask_prefix(uint64_t & high, uint64_t & low, const unsigned int prefix_length) noexcept
+    {
+        if (prefix_length <= 64)
+        {
+            high = prefix_length == 0 ? 0 : high & ~uint64_t {0} << (64 - prefix_length);
+            low = 0;
+        }
+        else
+        {
+            low = low & ~uint64_t {0} << (128 - prefix_length);
+        }
+    }
+}
+
+constexpr uint32_t ndgpp::net::ipv6_lpm_table::no_match;
+constexpr uint32_t ndgpp::net::ipv6_lpm_table::max_value;
+constexpr unsigned int ndgpp::net::ipv6_lpm_table::stride;
+constexpr unsigned int ndgpp::net::ipv6_lpm_table::depth_count;
+constexpr uint32_t ndgpp::net::ipv6_lpm_table::no_result;
+
+ndgpp::net::ipv6_lpm_table::ipv6_lpm_table():
+    nodes_(1)
+{}
+
+ndgpp::net::ipv6_lpm_table::ipv6_lpm_table(ipv6_lpm_table &&) noexcept = default;
+ndgpp::net::ipv6_lpm_table & ndgpp::net::ipv6_lpm_table::operator = (ipv6_lpm_table &&) noexcept = default;
+ndgpp::net::ipv6_lpm_table::~ipv6_lpm_table() = default;
+
+void ndgpp::net::ipv6_lpm_table::insert(const ndgpp::net::ipv6_address prefix,
+                                        const ndgpp::net::ipv6_prefix_length prefix_length,
+                                        const uint32_t value)
+{
+    if (value > max_value)
+    {
+        throw ndgpp_error(std::out_of_range, "ipv6_lpm_table value is greater than max_value");
+    }
+
+    uint64_t high = prefix.high();
+    uint64_t low = prefix.low();
+    mask_prefix(high, low, prefix_length.value());
+
+    // Walk to the node the prefix ends in, adding the missing nodes on the way
+    const unsigned int last_depth = prefix_length.value() / stride;
+    uint32_t index = 0;
+    for (unsigned int depth = 0; depth < last_depth; ++depth)
+    {
+        const unsigned int bits = chunk(high, low, depth);
+        const unsigned int position = rank(this->nodes_[index].external, bits);
+        if (!(this->nodes_[index].external >> bits & 1))
+        {
+            // Copy the children to a block with room for the new child
+            const std::size_t child_count = static_cast<std::size_t>(__builtin_popcountll(this->nodes_[index].external));
+            const uint32_t children = this->allocate_nodes(child_count + 1);
+
+            node & parent = this->nodes_[index];
+            std::copy_n(this->nodes_.begin() + parent.children, position, this->nodes_.begin() + children);
+            this->nodes_[children + position] = node {};
+            std::copy_n(this->nodes_.begin() + parent.children + position,
+                        child_count - position,
+                        this->nodes_.begin() + children + position + 1);
+
+            if (child_count != 0)
+            {
+                this->free_nodes_[child_count].push_back(parent.children);
+            }
+
+            parent.children = children;
+            parent.external |= uint64_t {1} << bits;
+        }
+
+        index = this->nodes_[index].children + position;
+    }
+
+    const unsigned int local_length = prefix_length.value() % stride;
+    const unsigned int bit = (1u << local_length) | (chunk(high, low, last_depth) >> (stride - local_length));
+    const unsigned int position = rank(this->nodes_[index].internal, bit);
+    if (this->nodes_[index].internal >> bit & 1)
+    {
+        this->results_[this->nodes_[index].results + position] = value;
+        return;
+    }
+
+    const std::size_t result_count = static_cast<std::size_t>(__builtin_popcountll(this->nodes_[index].internal));
+    const uint32_t results = this->allocate_results(result_count + 1);
+
+    node & n = this->nodes_[index];
+    std::copy_n(this->results_.begin() + n.results, position, this->results_.begin() + results);
+    this->results_[results + position] = value;
+    std::copy_n(this->results_.begin() + n.results + position,
+                result_count - position,
+                this->results_.begin() + results + position + 1);
+
+    if (result_count != 0)
+    {
+        this->free_results_[result_count].push_back(n.results);
+    }
+
+    n.results = results;
+    n.internal |= uint64_t {1} << bit;
+    ++this->size_;
+}
+
+bool ndgpp::net::ipv6_lpm_table::erase(const ndgpp::net::ipv6_address prefix, const ndgpp::net::ipv6_prefix_length prefix_length)
+{
+    uint64_t high = prefix.high();
+    uint64_t low = prefix.low();
+    mask_prefix(high, low, prefix_length.value());
+
+    // The nodes on the way to the prefix's node, so empty nodes can be removed from their parents
+    std::array<uint32_t, depth_count> path;
+    const unsigned int last_depth = prefix_length.value() / stride;
+    uint32_t index = 0;
+    for (unsigned int depth = 0; depth < last_depth; ++depth)
+    {
+        const unsigned int bits = chunk(high, low, depth);
+        if (!(this->nodes_[index].external >> bits & 1))
+        {
+            return false;
+        }
+
+        path[depth] = index;
+        index = this->nodes_[index].children + rank(this->nodes_[index].external, bits);
+    }
+
+    const unsigned int local_length = prefix_length.value() % stride;
+    const unsigned int bit = (1u << local_length) | (chunk(high, low, last_depth) >> (stride - local_length));
+    node & n = this->nodes_[index];
+    if (!(n.internal >> bit & 1))
+    {
+        return false;
+    }
+
+    // Copy the other values to a block one smaller
+    const std::size_t result_count = static_cast<std::size_t>(__builtin_popcountll(n.internal));
+    const unsigned int position = rank(n.internal, bit);
+    const uint32_t old_results = n.results;
+    uint32_t results = 0;
+    if (result_count > 1)
+    {
+        results = this->allocate_results(result_count - 1);
+        std::copy_n(this->results_.begin() + old_results, position, this->results_.begin() + results);
+        std::copy(this->results_.begin() + old_results + position + 1,
+                  this->results_.begin() + old_results + result_count,
+                  this->results_.begin() + results + position);
+    }
+
+    this->free_results_[result_count].push_back(old_results);
+    n.results = results;
+    n.internal &= ~(uint64_t {1} << bit);
+    --this->size_;
+
+    // Remove the nodes left without prefixes or children, the root is never removed
+    for (unsigned int depth = last_depth; depth > 0; --depth)
+    {
+        if (this->nodes_[index].internal != 0 || this->nodes_[index].external != 0)
+        {
+            break;
+        }
+
+        const uint32_t parent_index = path[depth - 1];
+        const unsigned int bits = chunk(high, low, depth - 1);
+        const std::size_t child_count = static_cast<std::size_t>(__builtin_popcountll(this->nodes_[parent_index].external));
+        const unsigned int child_position = rank(this->nodes_[parent_index].external, bits);
+        const uint32_t old_children = this->nodes_[parent_index].children;
+
+        uint32_t children = 0;
+        if (child_count > 1)
+        {
+            children = this->allocate_nodes(child_count - 1);
+            std::copy_n(this->nodes_.begin() + old_children, child_position, this->nodes_.begin() + children);
+            std::copy(this->nodes_.begin() + old_children + child_position + 1,
+                      this->nodes_.begin() + old_children + child_count,
+                      this->nodes_.begin() + children + child_position);
+        }
+
+        this->free_nodes_[child_count].push_back(old_children);
+        node & parent = this->nodes_[parent_index];
+        parent.children = children;
+        parent.external &= ~(uint64_t {1} << bits);
+        index = parent_index;
+    }
+
+    return true;
+}
+
+void ndgpp::net::ipv6_lpm_table::clear()
+{
+    this->nodes_.assign(1, node {});
+    this->results_.clear();
+    for (auto & blocks: this->free_nodes_)
+    {
+        blocks.clear();
+    }
+
+    for (auto & blocks: this->free_results_)
+    {
+        blocks.clear();
+    }
+
+    this->size_ = 0;
+}
+
+std::size_t ndgpp::net::ipv6_lpm_table::size() const noexcept
+{
+    return this->size_;
+}
+
+void ndgpp::net::ipv6_lpm_table::lookup(ndgpp::net::ipv6_address const * const addresses,
+                                        const std::size_t count,
+                                        uint32_t * const values) const noexcept
+{
+    node const * const nodes = this->nodes_.data();
+    for (std::size_t base = 0; base < count; base += batch_size)
+    {
+        const std::size_t lanes = std::min(batch_size, count - base);
+
+        node const * current[batch_size];
+        uint32_t results[batch_size];
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            current[lane] = nodes;
+            results[lane] = no_result;
+        }
+
+        // Each pass advances every unfinished walk by one level
+        std::size_t active = lanes;
+        for (unsigned int depth = 0; depth < depth_count && active != 0; ++depth)
+        {
+            active = 0;
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                node const * const n = current[lane];
+                if (n == nullptr)
+                {
+                    continue;
+                }
+
+                const ndgpp::net::ipv6_address & address = addresses[base + lane];
+                const unsigned int bits = chunk(address.high(), address.low(), depth);
+                const uint32_t node_result = match(*n, bits);
+                results[lane] = node_result != no_result ? node_result : results[lane];
+
+                if (n->external >> bits & 1)
+                {
+                    current[lane] = nodes + n->children + rank(n->external, bits);
+                    __builtin_prefetch(current[lane]);
+                    ++active;
+                }
+                else
+                {
+                    current[lane] = nullptr;
+                }
+            }
+        }
+
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            values[base + lane] = results[lane] != no_result ? this->results_[results[lane]] : no_match;
+        }
+    }
+}
+
+uint32_t ndgpp::net::ipv6_lpm_table::allocate_nodes(const std::size_t size)
+{
+    std::vector<uint32_t> & blocks = this->free_nodes_[size];
+    if (!blocks.empty())
+    {
+        const uint32_t index = blocks.back();
+        blocks.pop_back();
+        return index;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(this->nodes_.size());
+    this->nodes_.resize(this->nodes_.size() + size);
+    return index;
+}
+
+uint32_t ndgpp::net::ipv6_lpm_table::allocate_results(const std::size_t size)
+{
+    std::vector<uint32_t> & blocks = this->free_results_[size];
+    if (!blocks.empty())
+    {
+        const uint32_t index = blocks.back();
+        blocks.pop_back();
+        return index;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(this->results_.size());
+    this->results_.resize(this->results_.size() + size);
+    return index;
+}
@@ -0,0 +1,3 @@
+#include <libndgpp/net/multicast_ipv6_address.hpp>
+
+template class ndgpp::net::basic_ipv6_address<0xff00000000000000, 0xffffffffffffffff>;
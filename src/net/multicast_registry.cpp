@@ -0,0 +1,343 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/multicast_registry.hpp>
+
+namespace
+{
+    /// The number of packets looked up ahead of the current one in a batch
+    constexpr std::size_t prefetch_distance = 8;
+
+    /// Returns the table capacity for max_size subscriptions, keeping the load factor at or below 3/4
+    std::size_t table_capacity(const std::size_t max_size)
+    {
+        std::size_t capacity = 8;
+        while (capacity / 4 * 3 < max_size)
+        {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+}
+
+constexpr uint32_t ndgpp::net::multicast_registry::no_subscriber;
+constexpr uint64_t ndgpp::net::multicast_registry::empty_key;
+constexpr uint64_t ndgpp::net::multicast_registry::erased_key;
+
+ndgpp::net::multicast_registry::multicast_registry(const std::size_t max_size):
+    max_size_(max_size)
+{
+    if (max_size == 0)
+    {
+        throw ndgpp_error(std::invalid_argument, "multicast_registry max_size is zero");
+    }
+
+    const std::size_t capacity = table_capacity(max_size);
+    this->slots_.reset(new slot[capacity]);
+    this->mask_ = capacity - 1;
+}
+
+ndgpp::net::multicast_registry::multicast_registry(multicast_registry && other) noexcept:
+    slots_(std::move(other.slots_)),
+    mask_(other.mask_),
+    max_size_(other.max_size_),
+    size_(other.size_),
+    erased_(other.erased_),
+    generation_ {other.generation_.load(std::memory_order_relaxed)}
+{}
+
+ndgpp::net::multicast_registry & ndgpp::net::multicast_registry::operator = (multicast_registry && other) noexcept
+{
+    this->slots_ = std::move(other.slots_);
+    this->mask_ = other.mask_;
+    this->max_size_ = other.max_size_;
+    this->size_ = other.size_;
+    this->erased_ = other.erased_;
+    this->generation_.store(other.generation_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+ndgpp::net::multicast_registry::~multicast_registry() = default;
+
+void ndgpp::net::multicast_registry::insert(const ndgpp::net::multicast_ipv4_address group, const uint32_t handle)
+{
+    this->insert(make_key(0, group.to_uint32()), handle);
+}
+
+void ndgpp::net::multicast_registry::insert(const ndgpp::net::ipv4_address source,
+                                            const ndgpp::net::multicast_ipv4_address group,
+                                            const uint32_t handle)
+{
+    if (source.to_uint32() == 0)
+    {
+        throw ndgpp_error(std::invalid_argument, "multicast_registry source is 0.0.0.0");
+    }
+
+    this->insert(make_key(source.to_uint32(), group.to_uint32()), handle);
+}
+
+bool ndgpp::net::multicast_registry::erase(const ndgpp::net::multicast_ipv4_address group)
+{
+    return this->erase(make_key(0, group.to_uint32()));
+}
+
+bool ndgpp::net::multicast_registry::erase(const ndgpp::net::ipv4_address source, const ndgpp::net::multicast_ipv4_address group)
+{
+    if (source.to_uint32() == 0)
+    {
+        throw ndgpp_error(std::invalid_argument, "multicast_registry source is 0.0.0.0");
+    }
+
+    return this->erase(make_key(source.to_uint32(), group.to_uint32()));
+}
+
+void ndgpp::net::multicast_registry::clear() noexcept
+{
+    for (std::size_t i = 0; i <= this->mask_; ++i)
+    {
+        if (this->slots_[i].key.load(std::memory_order_relaxed) != empty_key)
+        {
+            store(this->slots_[i], empty_key, no_subscriber);
+        }
+    }
+
+    this->size_ = 0;
+    this->erased_ = 0;
+}
+
+void ndgpp::net::multicast_registry::lookup(ndgpp::net::multicast_ipv4_address const * const groups,
+                                            const std::size_t count,
+                                            uint32_t * const handles) const noexcept
+{
+    const std::size_t warmup = std::min(count, prefetch_distance);
+    for (std::size_t i = 0; i < warmup; ++i)
+    {
+        __builtin_prefetch(&this->slots_[this->home(make_key(0, groups[i].to_uint32()))]);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i + prefetch_distance < count)
+        {
+            __builtin_prefetch(&this->slots_[this->home(make_key(0, groups[i + prefetch_distance].to_uint32()))]);
+        }
+
+        handles[i] = this->lookup(groups[i]);
+    }
+}
+
+void ndgpp::net::multicast_registry::lookup(ndgpp::net::ipv4_address const * const sources,
+                                            ndgpp::net::multicast_ipv4_address const * const groups,
+                                            const std::size_t count,
+                                            uint32_t * const handles) const noexcept
+{
+    // Both the (S, G) and the (*, G) slots are prefetched since a
+    // miss on the first falls back to the second
+    auto prefetch = [this, sources, groups] (const std::size_t i) {
+        const uint32_t group = groups[i].to_uint32();
+        __builtin_prefetch(&this->slots_[this->home(make_key(sources[i].to_uint32(), group))]);
+        __builtin_prefetch(&this->slots_[this->home(make_key(0, group))]);
+    };
+
+    const std::size_t warmup = std::min(count, prefetch_distance);
+    for (std::size_t i = 0; i < warmup; ++i)
+    {
+        prefetch(i);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i + prefetch_distance < count)
+        {
+            prefetch(i + prefetch_distance);
+        }
+
+        handles[i] = this->lookup(sources[i], groups[i]);
+    }
+}
+
+std::size_t ndgpp::net::multicast_registry::size() const noexcept
+{
+    return this->size_;
+}
+
+std::size_t ndgpp::net::multicast_registry::max_size() const noexcept
+{
+    return this->max_size_;
+}
+
+std::size_t ndgpp::net::multicast_registry::capacity() const noexcept
+{
+    return this->mask_ + 1;
+}
+
+std::size_t ndgpp::net::multicast_registry::used_slots() const noexcept
+{
+    return this->size_ + this->erased_;
+}
+
+void ndgpp::net::multicast_registry::insert(const uint64_t key, const uint32_t handle)
+{
+    if (handle == no_subscriber)
+    {
+        throw ndgpp_error(std::invalid_argument, "multicast_registry handle is no_subscriber");
+    }
+
+    // Erased slots are reused, but only once the probe has reached an
+    // empty slot and so shown the key is not already in the table
+    slot * reuse = nullptr;
+    std::size_t index = this->home(key);
+    for (std::size_t probes = 0; probes <= this->mask_; ++probes)
+    {
+        slot & s = this->slots_[index];
+        const uint64_t slot_key = s.key.load(std::memory_order_relaxed);
+        if (slot_key == key)
+        {
+            store(s, key, handle);
+            return;
+        }
+
+        if (slot_key == erased_key && reuse == nullptr)
+        {
+            reuse = &s;
+        }
+        else if (slot_key == empty_key)
+        {
+            if (reuse == nullptr)
+            {
+                reuse = &s;
+            }
+
+            break;
+        }
+
+        index = (index + 1) & this->mask_;
+    }
+
+    if (this->size_ == this->max_size_ || reuse == nullptr)
+    {
+        throw ndgpp_error(std::length_error, "multicast_registry is full");
+    }
+
+    if (reuse->key.load(std::memory_order_relaxed) == erased_key)
+    {
+        --this->erased_;
+    }
+    else if (this->size_ + this->erased_ + 1 > this->capacity() / 4 * 3)
+    {
+        // Filling another empty slot would leave too few to end probes
+        this->rebuild();
+        index = this->home(key);
+        while (this->slots_[index].key.load(std::memory_order_relaxed) != empty_key)
+        {
+            index = (index + 1) & this->mask_;
+        }
+
+        reuse = &this->slots_[index];
+    }
+
+    store(*reuse, key, handle);
+    ++this->size_;
+}
+
+bool ndgpp::net::multicast_registry::erase(const uint64_t key)
+{
+    std::size_t index = this->home(key);
+    for (std::size_t probes = 0; probes <= this->mask_; ++probes)
+    {
+        slot & s = this->slots_[index];
+        const uint64_t slot_key = s.key.load(std::memory_order_relaxed);
+        if (slot_key == key)
+        {
+            --this->size_;
+
+            // The slot is marked erased rather than empty so probes
+            // for keys stored past it still reach them
+            const std::size_t next = (index + 1) & this->mask_;
+            if (this->slots_[next].key.load(std::memory_order_relaxed) != empty_key)
+            {
+                store(s, erased_key, no_subscriber);
+                ++this->erased_;
+                return true;
+            }
+
+            // No key is stored past the end of the probe sequence, so
+            // the slot and the erased slots in front of it are emptied
+            store(s, empty_key, no_subscriber);
+            index = (index - 1) & this->mask_;
+            while (this->slots_[index].key.load(std::memory_order_relaxed) == erased_key)
+            {
+                store(this->slots_[index], empty_key, no_subscriber);
+                --this->erased_;
+                index = (index - 1) & this->mask_;
+            }
+
+            return true;
+        }
+
+        if (slot_key == empty_key)
+        {
+            break;
+        }
+
+        index = (index + 1) & this->mask_;
+    }
+
+    return false;
+}
+
+void ndgpp::net::multicast_registry::rebuild()
+{
+    std::vector<std::pair<uint64_t, uint32_t>> subscriptions;
+    subscriptions.reserve(this->size_);
+    for (std::size_t i = 0; i <= this->mask_; ++i)
+    {
+        const uint64_t key = this->slots_[i].key.load(std::memory_order_relaxed);
+        if (key != empty_key && key != erased_key)
+        {
+            subscriptions.emplace_back(key, this->slots_[i].handle.load(std::memory_order_relaxed));
+        }
+    }
+
+    const uint32_t generation = this->generation_.load(std::memory_order_relaxed);
+    this->generation_.store(generation + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i <= this->mask_; ++i)
+    {
+        if (this->slots_[i].key.load(std::memory_order_relaxed) != empty_key)
+        {
+            store(this->slots_[i], empty_key, no_subscriber);
+        }
+    }
+
+    for (const auto & subscription: subscriptions)
+    {
+        std::size_t index = this->home(subscription.first);
+        while (this->slots_[index].key.load(std::memory_order_relaxed) != empty_key)
+        {
+            index = (index + 1) & this->mask_;
+        }
+
+        store(this->slots_[index], subscription.first, subscription.second);
+    }
+
+    this->erased_ = 0;
+    this->generation_.store(generation + 2, std::memory_order_release);
+}
+
+void ndgpp::net::multicast_registry::store(slot & s, const uint64_t key, const uint32_t handle) noexcept
+{
+    const uint32_t sequence = s.sequence.load(std::memory_order_relaxed);
+    s.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    s.key.store(key, std::memory_order_relaxed);
+    s.handle.store(handle, std::memory_order_relaxed);
+
+    s.sequence.store(sequence + 2, std::memory_order_release);
+}
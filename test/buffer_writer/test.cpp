@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <libndgpp/buffer_reader.hpp>
+#include <libndgpp/buffer_writer.hpp>
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/multicast_ipv4_address.hpp>
+#include <libndgpp/net/port.hpp>
+
+TEST(buffer_writer, put)
+{
+    std::array<uint8_t, 12> buf {};
+    ndgpp::buffer_writer writer {buf.data(), buf.size()};
+
+    writer.put(ndgpp::net::ipv4_address {0xc0a80001})
+        .put(ndgpp::net::port {80})
+        .put(ndgpp::network_byte_order<uint32_t> {0xdeadbeef})
+        .put(uint8_t {0x11});
+
+    EXPECT_EQ(11U, writer.written());
+    EXPECT_EQ(1U, writer.remaining());
+
+    const std::array<uint8_t, 12> expected = {0xc0, 0xa8, 0x00, 0x01, 0x00, 0x50, 0xde, 0xad, 0xbe, 0xef, 0x11, 0x00};
+    EXPECT_EQ(expected, buf);
+}
+
+TEST(buffer_writer, put_overflow)
+{
+    std::array<uint8_t, 3> buf {};
+    ndgpp::buffer_writer writer {buf.data(), buf.size()};
+
+    EXPECT_THROW(writer.put(ndgpp::network_byte_order<uint32_t> {1}), ndgpp::error<std::out_of_range>);
+    EXPECT_EQ(0U, writer.written());
+}
+
+TEST(buffer_writer, reserve_then_unchecked)
+{
+    std::array<uint8_t, 6> buf {};
+    ndgpp::buffer_writer writer {buf.data(), buf.size()};
+
+    writer.reserve(6);
+    writer.put(ndgpp::unchecked, ndgpp::network_byte_order<uint16_t> {0x0102});
+    writer.put(ndgpp::unchecked, std::array<uint8_t, 2> {0x03, 0x04});
+    const std::array<uint8_t, 2> bytes = {0x05, 0x06};
+    writer.put(ndgpp::unchecked, bytes.data(), bytes.size());
+
+    const std::array<uint8_t, 6> expected = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    EXPECT_EQ(expected, buf);
+    EXPECT_THROW(writer.reserve(1), ndgpp::error<std::out_of_range>);
+}
+
+TEST(buffer_writer, put_all)
+{
+    std::array<uint8_t, 8> buf {};
+    ndgpp::buffer_writer writer {buf.data(), buf.size()};
+
+    writer.put_all(ndgpp::net::ipv4_address {0x0a000001}, ndgpp::net::port {1}, ndgpp::net::port {2});
+    EXPECT_EQ(8U, writer.written());
+
+    EXPECT_THROW(writer.put_all(uint8_t {1}), ndgpp::error<std::out_of_range>);
+
+    ndgpp::buffer_writer small {buf.data(), 7};
+    EXPECT_THROW(small.put_all(ndgpp::net::ipv4_address {0x0a000001}, ndgpp::net::port {1}, ndgpp::net::port {2}),
+                 ndgpp::error<std::out_of_range>);
+    EXPECT_EQ(0U, small.written());
+}
+
+TEST(buffer_reader, get)
+{
+    const std::array<uint8_t, 11> buf = {0xc0, 0xa8, 0x00, 0x01, 0x00, 0x50, 0xde, 0xad, 0xbe, 0xef, 0x11};
+    ndgpp::buffer_reader reader {buf.data(), buf.size()};
+
+    EXPECT_EQ(ndgpp::net::ipv4_address {0xc0a80001}, reader.get<ndgpp::net::ipv4_address>());
+    EXPECT_EQ(80, reader.get<ndgpp::net::port>());
+    EXPECT_EQ(0xdeadbeef, reader.get<ndgpp::network_byte_order<uint32_t>>());
+    EXPECT_EQ(0x11, reader.get<uint8_t>());
+    EXPECT_EQ(0U, reader.remaining());
+    EXPECT_THROW(reader.get<uint8_t>(), ndgpp::error<std::out_of_range>);
+}
+
+TEST(buffer_reader, get_all)
+{
+    const std::array<uint8_t, 10> buf = {0x0a, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0xaa, 0xbb};
+    ndgpp::buffer_reader reader {buf.data(), buf.size()};
+
+    ndgpp::net::ipv4_address address;
+    ndgpp::net::port src;
+    ndgpp::net::port dst;
+    reader.get_all(address, src, dst);
+
+    EXPECT_EQ(ndgpp::net::ipv4_address {0x0a000001}, address);
+    EXPECT_EQ(1, src);
+    EXPECT_EQ(2, dst);
+
+    uint8_t const * const bytes = reader.view(2);
+    EXPECT_EQ(buf.data() + 8, bytes);
+    EXPECT_THROW(reader.get_all(src), ndgpp::error<std::out_of_range>);
+}
+
+TEST(buffer_reader, constrained_address)
+{
+    const std::array<uint8_t, 8> buf = {0x01, 0x02, 0x03, 0x04, 0xe0, 0x00, 0x00, 0x01};
+    ndgpp::buffer_reader reader {buf.data(), buf.size()};
+
+    // A failed read leaves the cursor on the value
+    EXPECT_THROW(reader.get<ndgpp::net::multicast_ipv4_address>(), ndgpp::error<std::out_of_range>);
+    EXPECT_EQ(8U, reader.remaining());
+    EXPECT_THROW(reader.get<ndgpp::net::multicast_ipv4_address>(ndgpp::unchecked), ndgpp::error<std::out_of_range>);
+    EXPECT_EQ(8U, reader.remaining());
+
+    EXPECT_EQ(ndgpp::net::ipv4_address {0x01020304}, reader.get<ndgpp::net::ipv4_address>());
+    EXPECT_EQ(ndgpp::net::multicast_ipv4_address {0xe0000001}, reader.get<ndgpp::net::multicast_ipv4_address>());
+    EXPECT_EQ(0U, reader.remaining());
+}
+
+TEST(buffer_cursor, round_trip)
+{
+    std::array<uint8_t, 16> buf {};
+    ndgpp::buffer_writer writer {buf.data(), buf.size()};
+    writer.put_all(ndgpp::network_byte_order<uint64_t> {0x0102030405060708},
+                   ndgpp::network_byte_order<uint16_t> {0x090a});
+    writer.skip(2);
+    writer.put(ndgpp::unaligned_network_byte_order<uint32_t> {0x0b0c0d0e});
+
+    ndgpp::buffer_reader reader {buf.data(), writer.written()};
+    ndgpp::network_byte_order<uint64_t> a;
+    ndgpp::network_byte_order<uint16_t> b;
+    reader.get_all(a, b).skip(2);
+
+    EXPECT_EQ(0x0102030405060708U, a);
+    EXPECT_EQ(0x090a, b);
+    EXPECT_EQ(0x0b0c0d0eU, reader.get<ndgpp::unaligned_network_byte_order<uint32_t>>());
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <libndgpp/crc32c.hpp>
+
+namespace
+{
+    std::vector<uint8_t> random_bytes(const std::size_t size)
+    {
+        std::mt19937 engine {3720};
+        std::uniform_int_distribution<unsigned> distribution {0, 255};
+        std::vector<uint8_t> bytes(size);
+        for (auto & byte: bytes)
+        {
+            byte = static_cast<uint8_t>(distribution(engine));
+        }
+
+        return bytes;
+    }
+}
+
+TEST(crc32c, check_value)
+{
+    const char data[] = "123456789";
+    EXPECT_EQ(0xe3069283, ndgpp::crc32c(data, 9));
+    EXPECT_EQ(0xe3069283, ndgpp::detail::crc32c_portable(data, 9, 0));
+}
+
+TEST(crc32c, zeros)
+{
+    const std::array<uint8_t, 32> zeros {};
+    EXPECT_EQ(0x8a9136aa, ndgpp::crc32c(zeros.data(), zeros.size()));
+}
+
+TEST(crc32c, empty)
+{
+    EXPECT_EQ(0U, ndgpp::crc32c(nullptr, 0));
+}
+
+TEST(crc32c, matches_portable)
+{
+    const std::vector<uint8_t> bytes = random_bytes(3 * 8192 * 2 + 3 * 256 + 77);
+
+    for (std::size_t size: {std::size_t {1}, std::size_t {7}, std::size_t {8}, std::size_t {767},
+                            std::size_t {768}, std::size_t {3 * 8192}, bytes.size() - 3})
+    {
+        for (std::size_t offset = 0; offset < 3; ++offset)
+        {
+            EXPECT_EQ(ndgpp::detail::crc32c_portable(bytes.data() + offset, size, 0),
+                      ndgpp::crc32c(bytes.data() + offset, size)) << size << ' ' << offset;
+        }
+    }
+}
+
+TEST(crc32c, continuation)
+{
+    const std::vector<uint8_t> bytes = random_bytes(1000);
+    const uint32_t first = ndgpp::crc32c(bytes.data(), 300);
+    EXPECT_EQ(ndgpp::crc32c(bytes.data(), bytes.size()),
+              ndgpp::crc32c(bytes.data() + 300, bytes.size() - 300, first));
+}
+
+TEST(crc32c, combine)
+{
+    const std::vector<uint8_t> bytes = random_bytes(1000);
+
+    for (std::size_t split: {std::size_t {0}, std::size_t {1}, std::size_t {500}, std::size_t {999}, std::size_t {1000}})
+    {
+        const uint32_t crc1 = ndgpp::crc32c(bytes.data(), split);
+        const uint32_t crc2 = ndgpp::crc32c(bytes.data() + split, bytes.size() - split);
+        EXPECT_EQ(ndgpp::crc32c(bytes.data(), bytes.size()),
+                  ndgpp::crc32c_combine(crc1, crc2, bytes.size() - split)) << split;
+    }
+}
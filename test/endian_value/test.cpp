@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include <libndgpp/endian_value.hpp>
+#include <libndgpp/network_byte_order.hpp>
+
+namespace
+{
+    enum class message_type: uint16_t
+    {
+        hello = 0x0102,
+        goodbye = 0x0304
+    };
+
+    template <class T, ndgpp::endian Order>
+    std::array<uint8_t, sizeof(T)> bytes(const ndgpp::endian_value<T, Order> & value)
+    {
+        std::array<uint8_t, sizeof(T)> buf;
+        std::memcpy(buf.data(), &value, value.size());
+        return buf;
+    }
+}
+
+TEST(endian_value, network_byte_order_alias)
+{
+    constexpr bool same = std::is_same<ndgpp::network_byte_order<uint32_t>,
+                                       ndgpp::endian_value<uint32_t, ndgpp::endian::big>>::value;
+    EXPECT_TRUE(same);
+}
+
+TEST(endian_value, unsigned_layout)
+{
+    const ndgpp::big_endian<uint32_t> big {0x01020304};
+    const ndgpp::little_endian<uint32_t> little {0x01020304};
+
+    EXPECT_EQ((std::array<uint8_t, 4> {0x01, 0x02, 0x03, 0x04}), bytes(big));
+    EXPECT_EQ((std::array<uint8_t, 4> {0x04, 0x03, 0x02, 0x01}), bytes(little));
+    EXPECT_EQ(0x01020304U, static_cast<uint32_t>(big));
+    EXPECT_EQ(0x01020304U, static_cast<uint32_t>(little));
+}
+
+TEST(endian_value, constexpr_integral)
+{
+    constexpr ndgpp::little_endian<uint16_t> little {0xabcd};
+    constexpr uint16_t value = little;
+    EXPECT_EQ(0xabcd, value);
+}
+
+TEST(endian_value, signed_value)
+{
+    const ndgpp::big_endian<int16_t> big {-2};
+    EXPECT_EQ((std::array<uint8_t, 2> {0xff, 0xfe}), bytes(big));
+    EXPECT_EQ(-2, static_cast<int16_t>(big));
+
+    const ndgpp::little_endian<int64_t> little {std::numeric_limits<int64_t>::min()};
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), static_cast<int64_t>(little));
+    EXPECT_EQ(0x80, bytes(little)[7]);
+}
+
+TEST(endian_value, enum_value)
+{
+    ndgpp::big_endian<message_type> big {message_type::hello};
+    EXPECT_EQ((std::array<uint8_t, 2> {0x01, 0x02}), bytes(big));
+    EXPECT_EQ(message_type::hello, static_cast<message_type>(big));
+
+    big = message_type::goodbye;
+    EXPECT_EQ(message_type::goodbye, static_cast<message_type>(big));
+}
+
+TEST(endian_value, floating_point)
+{
+    const ndgpp::big_endian<double> big {1.0};
+    EXPECT_EQ((std::array<uint8_t, 8> {0x3f, 0xf0, 0, 0, 0, 0, 0, 0}), bytes(big));
+    EXPECT_EQ(1.0, static_cast<double>(big));
+
+    const ndgpp::little_endian<float> little {-2.5f};
+    EXPECT_EQ(-2.5f, static_cast<float>(little));
+    EXPECT_EQ((std::array<uint8_t, 4> {0x00, 0x00, 0x20, 0xc0}), bytes(little));
+}
+
+TEST(endian_value, order_conversion)
+{
+    const ndgpp::big_endian<uint32_t> big {0xdeadbeef};
+    const ndgpp::little_endian<uint32_t> little {big};
+    EXPECT_EQ(0xdeadbeefU, static_cast<uint32_t>(little));
+}
+
+TEST(endian_value, ordering)
+{
+    const ndgpp::big_endian<int32_t> negative {-1};
+    const ndgpp::big_endian<int32_t> positive {0x100};
+    const ndgpp::big_endian<int32_t> small {0xff};
+
+    EXPECT_LT(negative, positive);
+    EXPECT_LT(small, positive);
+    EXPECT_GT(positive, small);
+    EXPECT_NE(negative, positive);
+    EXPECT_EQ(positive, positive);
+}
+
+TEST(endian_value, insertion)
+{
+    std::stringstream ss;
+    ss << ndgpp::little_endian<int32_t> {-42};
+    EXPECT_EQ("-42", ss.str());
+}
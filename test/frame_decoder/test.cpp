@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <libndgpp/frame_decoder.hpp>
+
+namespace
+{
+    std::vector<uint8_t> make_stream(const std::vector<std::string> & payloads)
+    {
+        std::vector<uint8_t> stream;
+        for (const auto & payload: payloads)
+        {
+            stream.push_back(static_cast<uint8_t>(payload.size() >> 8));
+            stream.push_back(static_cast<uint8_t>(payload.size()));
+            stream.insert(stream.end(), payload.begin(), payload.end());
+        }
+
+        return stream;
+    }
+
+    struct collector
+    {
+        void operator() (const ndgpp::frame_view frame)
+        {
+            frames.emplace_back(frame.data(), frame.data() + frame.size());
+            views.push_back(frame.data());
+        }
+
+        std::vector<std::string> frames;
+        std::vector<uint8_t const *> views;
+    };
+}
+
+TEST(frame_decoder, whole_chunk)
+{
+    const std::vector<std::string> payloads = {"hello", "", "world!"};
+    const std::vector<uint8_t> stream = make_stream(payloads);
+
+    ndgpp::frame_decoder<uint16_t> decoder;
+    collector frames;
+    EXPECT_EQ(3U, decoder.feed(stream.data(), stream.size(), std::ref(frames)));
+    EXPECT_EQ(payloads, frames.frames);
+    EXPECT_EQ(0U, decoder.buffered());
+
+    // Frames are views of the chunk
+    EXPECT_EQ(stream.data() + 2, frames.views[0]);
+}
+
+TEST(frame_decoder, every_split)
+{
+    const std::vector<std::string> payloads = {"hello", "", "world!", std::string(300, 'x')};
+    const std::vector<uint8_t> stream = make_stream(payloads);
+
+    for (std::size_t split = 0; split <= stream.size(); ++split)
+    {
+        ndgpp::frame_decoder<uint16_t> decoder;
+        collector frames;
+        decoder.feed(stream.data(), split, std::ref(frames));
+        decoder.feed(stream.data() + split, stream.size() - split, std::ref(frames));
+        EXPECT_EQ(payloads, frames.frames) << split;
+        EXPECT_EQ(0U, decoder.buffered());
+    }
+}
+
+TEST(frame_decoder, byte_at_a_time)
+{
+    const std::vector<std::string> payloads = {"abc", "defg"};
+    const std::vector<uint8_t> stream = make_stream(payloads);
+
+    ndgpp::frame_decoder<uint16_t> decoder;
+    collector frames;
+    for (const uint8_t byte: stream)
+    {
+        decoder.feed(&byte, 1, std::ref(frames));
+    }
+
+    EXPECT_EQ(payloads, frames.frames);
+}
+
+TEST(frame_decoder, uint32_prefix)
+{
+    const std::vector<uint8_t> stream = {0, 0, 0, 3, 'a', 'b', 'c', 0, 0, 0};
+
+    ndgpp::frame_decoder<uint32_t> decoder;
+    collector frames;
+    EXPECT_EQ(1U, decoder.feed(stream.data(), stream.size(), std::ref(frames)));
+    EXPECT_EQ(std::vector<std::string> {"abc"}, frames.frames);
+    EXPECT_EQ(3U, decoder.buffered());
+
+    decoder.reset();
+    EXPECT_EQ(0U, decoder.buffered());
+}
+
+TEST(frame_decoder, max_frame_size)
+{
+    const std::vector<uint8_t> stream = make_stream({"too long"});
+
+    ndgpp::frame_decoder<uint16_t> decoder {4};
+    collector frames;
+    EXPECT_THROW(decoder.feed(stream.data(), stream.size(), std::ref(frames)), ndgpp::error<std::length_error>);
+
+    ndgpp::frame_decoder<uint16_t> split_decoder {4};
+    EXPECT_EQ(0U, split_decoder.feed(stream.data(), 1, std::ref(frames)));
+    EXPECT_THROW(split_decoder.feed(stream.data() + 1, 1, std::ref(frames)), ndgpp::error<std::length_error>);
+    EXPECT_TRUE(frames.frames.empty());
+}
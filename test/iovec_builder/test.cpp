@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/iovec_builder.hpp>
+#include <libndgpp/network_byte_order.hpp>
+
+namespace
+{
+    std::string flatten(const struct iovec * iov, const std::size_t count)
+    {
+        std::string str;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            str.append(static_cast<char const *>(iov[i].iov_base), iov[i].iov_len);
+        }
+
+        return str;
+    }
+}
+
+TEST(iovec_builder, empty)
+{
+    ndgpp::iovec_builder<> builder;
+    EXPECT_EQ(0U, builder.iovec_count());
+    EXPECT_EQ(0U, builder.message_count());
+}
+
+TEST(iovec_builder, header_and_payload)
+{
+    const std::string payload = "hello";
+
+    ndgpp::iovec_builder<> builder;
+    builder.put(ndgpp::network_byte_order<uint16_t> {0x0102},
+                ndgpp::network_byte_order<uint32_t> {5});
+    builder.payload(payload.data(), payload.size());
+    builder.end_message();
+
+    ASSERT_EQ(2U, builder.iovec_count());
+    ASSERT_EQ(1U, builder.message_count());
+
+    EXPECT_EQ(6U, builder.iovecs()[0].iov_len);
+    EXPECT_EQ(payload.data(), builder.iovecs()[1].iov_base);
+    EXPECT_EQ(std::string("\x01\x02\x00\x00\x00\x05hello", 11), flatten(builder.iovecs(), builder.iovec_count()));
+}
+
+TEST(iovec_builder, consecutive_headers_coalesce)
+{
+    ndgpp::iovec_builder<> builder;
+    builder.put(ndgpp::network_byte_order<uint16_t> {1});
+    builder.put(ndgpp::network_byte_order<uint16_t> {2});
+    std::memset(builder.header(2), 0xff, 2);
+
+    ASSERT_EQ(1U, builder.iovec_count());
+    EXPECT_EQ(std::string("\x00\x01\x00\x02\xff\xff", 6), flatten(builder.iovecs(), builder.iovec_count()));
+}
+
+TEST(iovec_builder, messages)
+{
+    const std::string first = "first";
+    const std::string second = "second";
+
+    ndgpp::iovec_builder<> builder;
+    builder.put(ndgpp::network_byte_order<uint16_t> {5}).payload(first.data(), first.size()).end_message();
+    builder.put(ndgpp::network_byte_order<uint16_t> {6}).payload(second.data(), second.size()).end_message();
+
+    ASSERT_EQ(2U, builder.message_count());
+    ASSERT_EQ(4U, builder.iovec_count());
+
+    // Headers of adjacent messages are not coalesced
+    EXPECT_EQ(2U, builder.message_iovec_count(0));
+    EXPECT_EQ(2U, builder.message_iovec_count(1));
+    EXPECT_EQ(std::string("\x00\x05" "first", 7), flatten(builder.message_iovecs(0), builder.message_iovec_count(0)));
+    EXPECT_EQ(std::string("\x00\x06" "second", 8), flatten(builder.message_iovecs(1), builder.message_iovec_count(1)));
+
+    struct msghdr hdr {};
+    builder.fill(hdr, 1);
+    EXPECT_EQ(builder.message_iovecs(1), hdr.msg_iov);
+    EXPECT_EQ(2U, hdr.msg_iovlen);
+}
+
+TEST(iovec_builder, writev)
+{
+    const std::string payload = "payload";
+
+    ndgpp::iovec_builder<> builder;
+    builder.put(ndgpp::network_byte_order<uint32_t> {static_cast<uint32_t>(payload.size())});
+    builder.payload(payload.data(), payload.size());
+
+    int fds[2];
+    ASSERT_EQ(0, ::pipe(fds));
+
+    const ssize_t written = ::writev(fds[1], builder.iovecs(), static_cast<int>(builder.iovec_count()));
+    ASSERT_EQ(11, written);
+
+    char buf[11];
+    ASSERT_EQ(11, ::read(fds[0], buf, sizeof(buf)));
+    EXPECT_EQ(std::string("\x00\x00\x00\x07payload", 11), std::string(buf, sizeof(buf)));
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+TEST(iovec_builder, clear)
+{
+    ndgpp::iovec_builder<> builder;
+    builder.put(ndgpp::network_byte_order<uint16_t> {1}).end_message();
+    builder.clear();
+
+    EXPECT_EQ(0U, builder.iovec_count());
+    EXPECT_EQ(0U, builder.message_count());
+}
+
+TEST(iovec_builder, scratch_full)
+{
+    ndgpp::iovec_builder<4> builder;
+    builder.put(ndgpp::network_byte_order<uint16_t> {1});
+    EXPECT_THROW(builder.put(ndgpp::network_byte_order<uint32_t> {1}), ndgpp::error<std::length_error>);
+}
+
+TEST(iovec_builder, iovecs_full)
+{
+    const char payload[] = "abcd";
+
+    // The payloads are not adjacent, so each one needs an iovec
+    ndgpp::iovec_builder<16, 2> builder;
+    builder.payload(payload, 1);
+    builder.payload(payload + 2, 1);
+    EXPECT_THROW(builder.payload(payload, 1), ndgpp::error<std::length_error>);
+}
+
+TEST(iovec_builder, messages_full)
+{
+    ndgpp::iovec_builder<16, 4, 1> builder;
+    builder.end_message();
+    EXPECT_THROW(builder.end_message(), ndgpp::error<std::length_error>);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <libndgpp/message_codec.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/port.hpp>
+#include <libndgpp/network_byte_order.hpp>
+
+namespace
+{
+    using codec = ndgpp::message_codec<std::tuple<ndgpp::network_byte_order<uint32_t>,
+                                                  ndgpp::net::ipv4_address,
+                                                  ndgpp::net::port,
+                                                  uint8_t>>;
+
+    codec::value_type make_message(const uint32_t i)
+    {
+        return codec::value_type {ndgpp::network_byte_order<uint32_t> {i},
+                                  ndgpp::net::ipv4_address {std::array<uint8_t, 4> {{10, 0, 0, static_cast<uint8_t>(i)}}},
+                                  ndgpp::net::port {static_cast<uint16_t>(1000 + i)},
+                                  static_cast<uint8_t>(i * 2)};
+    }
+}
+
+TEST(message_codec, layout)
+{
+    EXPECT_EQ(11U, codec::size);
+    EXPECT_EQ(0U, codec::offset<0>());
+    EXPECT_EQ(4U, codec::offset<1>());
+    EXPECT_EQ(8U, codec::offset<2>());
+    EXPECT_EQ(10U, codec::offset<3>());
+    EXPECT_EQ(2U, codec::index<ndgpp::net::port>());
+}
+
+TEST(message_codec, encode)
+{
+    uint8_t buf[codec::size];
+    codec::encode(buf, make_message(1));
+
+    const uint8_t expected[] = {0, 0, 0, 1, 10, 0, 0, 1, 0x03, 0xe9, 2};
+    EXPECT_TRUE(std::equal(std::begin(expected), std::end(expected), std::begin(buf)));
+}
+
+TEST(message_codec, round_trip)
+{
+    uint8_t buf[codec::size];
+    const codec::value_type msg = make_message(7);
+    codec::encode(buf, msg);
+    EXPECT_EQ(msg, codec::decode(buf));
+}
+
+TEST(message_codec, decode_column)
+{
+    std::vector<codec::value_type> msgs;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        msgs.push_back(make_message(i));
+    }
+
+    std::vector<uint8_t> buf(msgs.size() * codec::size);
+    codec::encode(buf.data(), msgs.data(), msgs.size());
+
+    std::vector<ndgpp::net::port> ports(msgs.size());
+    codec::decode_column<ndgpp::net::port>(buf.data(), msgs.size(), ports.data());
+
+    std::vector<uint8_t> bytes(msgs.size());
+    codec::decode_column<3>(buf.data(), msgs.size(), bytes.data());
+
+    for (std::size_t i = 0; i < msgs.size(); ++i)
+    {
+        EXPECT_EQ(std::get<2>(msgs[i]), ports[i]);
+        EXPECT_EQ(std::get<3>(msgs[i]), bytes[i]);
+    }
+}
+
+TEST(message_codec, decode_columns)
+{
+    std::vector<codec::value_type> msgs;
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        msgs.push_back(make_message(i));
+    }
+
+    std::vector<uint8_t> buf(msgs.size() * codec::size);
+    codec::encode(buf.data(), msgs.data(), msgs.size());
+
+    std::vector<ndgpp::network_byte_order<uint32_t>> seqs(msgs.size());
+    std::vector<ndgpp::net::ipv4_address> addrs(msgs.size());
+    std::vector<uint8_t> bytes(msgs.size());
+    codec::decode_columns(buf.data(), msgs.size(), seqs.data(), addrs.data(), nullptr, bytes.data());
+
+    for (std::size_t i = 0; i < msgs.size(); ++i)
+    {
+        EXPECT_EQ(std::get<0>(msgs[i]), seqs[i]);
+        EXPECT_EQ(std::get<1>(msgs[i]), addrs[i]);
+        EXPECT_EQ(std::get<3>(msgs[i]), bytes[i]);
+    }
+}
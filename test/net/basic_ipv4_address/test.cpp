@@ -1,4 +1,5 @@
 #include <sstream>
+#include <unordered_set>
 #include <utility>
 #include <gtest/gtest.h>
 
@@ -378,3 +379,52 @@ TEST(ostream, test)
     ss << addr;
     EXPECT_EQ(expected, ss.str());
 }
+
+TEST(octets, index)
+{
+    constexpr ndgpp::net::basic_ipv4_address<> addr {ndgpp::net::ipv4_array{10, 20, 30, 40}};
+    static_assert(addr[0] == 10 && addr[3] == 40, "bug in ndgpp::net::basic_ipv4_address::operator[]");
+
+    EXPECT_EQ(10, addr[0]);
+    EXPECT_EQ(20, addr[1]);
+    EXPECT_EQ(30, addr[2]);
+    EXPECT_EQ(40, addr[3]);
+}
+
+TEST(comparison, octet_order)
+{
+    // Ordering by value matches ordering by octets
+    const ndgpp::net::basic_ipv4_address<> low {ndgpp::net::ipv4_array{9, 255, 255, 255}};
+    const ndgpp::net::basic_ipv4_address<> high {ndgpp::net::ipv4_array{10, 0, 0, 0}};
+    EXPECT_LT(low, high);
+    EXPECT_NE(low, high);
+}
+
+TEST(hash, unordered_set)
+{
+    std::unordered_set<ndgpp::net::basic_ipv4_address<>> addrs;
+    for (uint32_t i = 0; i < 1024; ++i)
+    {
+        addrs.insert(ndgpp::net::basic_ipv4_address<> {0x0a000000 + i});
+    }
+
+    EXPECT_EQ(1024U, addrs.size());
+    EXPECT_EQ(1U, addrs.count(ndgpp::net::basic_ipv4_address<> {0x0a000010}));
+    EXPECT_EQ(0U, addrs.count(ndgpp::net::basic_ipv4_address<> {0x0b000000}));
+}
+
+TEST(hash, mixes_low_bits)
+{
+    // The network addresses of the 256 /24s in 192.168.0.0/16 differ
+    // only in their third octet, which the identity hash would leave
+    // out of the low byte entirely.  Mixed, they spread across more
+    // than half of the 256 low byte values.
+    const std::hash<ndgpp::net::basic_ipv4_address<>> hasher;
+    std::unordered_set<std::size_t> buckets;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        buckets.insert(hasher(ndgpp::net::basic_ipv4_address<> {0xc0a80000 + (i << 8)}) & 0xff);
+    }
+
+    EXPECT_GT(buckets.size(), 128U);
+}
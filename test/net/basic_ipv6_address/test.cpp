@@ -0,0 +1,137 @@
+#include <sstream>
+#include <unordered_set>
+#include <utility>
+#include <gtest/gtest.h>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv6_address.hpp>
+#include <libndgpp/net/multicast_ipv6_address.hpp>
+
+TEST(ctor, default_ctor)
+{
+    constexpr ndgpp::net::ipv6_address addr {};
+    const ndgpp::net::ipv6_address::value_type expected {};
+    EXPECT_EQ(expected, addr.value());
+
+    constexpr ndgpp::net::multicast_ipv6_address multicast {};
+    EXPECT_EQ(0xff00000000000000, multicast.high());
+    EXPECT_EQ(0U, multicast.low());
+}
+
+TEST(ctor, value_type)
+{
+    constexpr ndgpp::net::ipv6_array value {0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+    const ndgpp::net::ipv6_address addr {value};
+
+    EXPECT_EQ(value, addr.value());
+    EXPECT_EQ(0x20010db800000000, addr.high());
+    EXPECT_EQ(1U, addr.low());
+    EXPECT_EQ(0x20, addr[0]);
+    EXPECT_EQ(0x0d, addr[2]);
+    EXPECT_EQ(1, addr[15]);
+}
+
+TEST(ctor, uint64)
+{
+    constexpr ndgpp::net::ipv6_address addr {0xfe80000000000000, 0x0123456789abcdef};
+    static_assert(addr.high() == 0xfe80000000000000, "");
+    static_assert(addr[8] == 0x01, "");
+    EXPECT_EQ("fe80::123:4567:89ab:cdef", addr.to_string());
+}
+
+TEST(ctor, string)
+{
+    const ndgpp::net::ipv6_address addr {std::string {"2001:db8::8:800:200c:417a"}};
+    EXPECT_EQ(0x20010db800000000, addr.high());
+    EXPECT_EQ(0x00080800200c417a, addr.low());
+
+    EXPECT_THROW(ndgpp::net::ipv6_address {std::string {"2001:db8::8::1"}}, ndgpp::error<std::invalid_argument>);
+}
+
+TEST(constrained_ctor, multicast)
+{
+    const ndgpp::net::multicast_ipv6_address addr {std::string {"ff02::1"}};
+    EXPECT_EQ(0xff02000000000000, addr.high());
+
+    EXPECT_THROW(ndgpp::net::multicast_ipv6_address {std::string {"fe80::1"}}, ndgpp::error<std::out_of_range>);
+    EXPECT_THROW((ndgpp::net::multicast_ipv6_address {0xfeffffffffffffff, 0}), ndgpp::error<std::out_of_range>);
+}
+
+TEST(constrained_ctor, conversion)
+{
+    const ndgpp::net::multicast_ipv6_address multicast {std::string {"ff05::2"}};
+    const ndgpp::net::ipv6_address addr {multicast};
+    EXPECT_EQ(multicast.value(), addr.value());
+
+    const ndgpp::net::ipv6_address unicast {std::string {"2001:db8::1"}};
+    auto throws = [unicast] () {ndgpp::net::multicast_ipv6_address multicast {unicast};};
+    EXPECT_THROW(throws(), ndgpp::error<std::out_of_range>);
+
+    EXPECT_TRUE(noexcept(ndgpp::net::ipv6_address {multicast}));
+}
+
+TEST(assignment, values)
+{
+    ndgpp::net::multicast_ipv6_address addr;
+    addr = std::string {"ff02::fb"};
+    EXPECT_EQ("ff02::fb", addr.to_string());
+
+    EXPECT_THROW(addr = std::string {"::1"}, ndgpp::error<std::out_of_range>);
+    EXPECT_EQ("ff02::fb", addr.to_string());
+
+    addr = ndgpp::net::make_ipv6_array(0xff01000000000000, 1);
+    EXPECT_EQ("ff01::1", addr.to_string());
+}
+
+TEST(comparison, ordering)
+{
+    const ndgpp::net::ipv6_address a {0, 0xffffffffffffffff};
+    const ndgpp::net::ipv6_address b {1, 0};
+    const ndgpp::net::ipv6_address c {1, 1};
+
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b < c);
+    EXPECT_TRUE(c > a);
+    EXPECT_TRUE(a <= a);
+    EXPECT_TRUE(a >= a);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(b == ndgpp::net::ipv6_address (1, 0));
+}
+
+TEST(swap, swap)
+{
+    ndgpp::net::ipv6_address a {1, 2};
+    ndgpp::net::ipv6_address b {3, 4};
+    swap(a, b);
+    EXPECT_EQ(3U, a.high());
+    EXPECT_EQ(2U, b.low());
+}
+
+TEST(output, stream_and_to_chars)
+{
+    const ndgpp::net::ipv6_address addr {std::string {"::ffff:10.0.0.1"}};
+    std::ostringstream stream;
+    stream << addr;
+    EXPECT_EQ("::ffff:10.0.0.1", stream.str());
+
+    char buffer[ndgpp::net::ipv6_max_chars];
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer, buffer + sizeof(buffer), addr);
+    EXPECT_EQ(std::errc {}, result.ec);
+    EXPECT_EQ("::ffff:10.0.0.1", std::string(buffer, result.ptr));
+}
+
+TEST(hash, distinct)
+{
+    std::unordered_set<ndgpp::net::ipv6_address> addresses;
+    std::unordered_set<std::size_t> hashes;
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        const ndgpp::net::ipv6_address addr {0x20010db800000000, i};
+        addresses.insert(addr);
+        hashes.insert(std::hash<ndgpp::net::ipv6_address> {} (addr));
+    }
+
+    EXPECT_EQ(1000U, addresses.size());
+    EXPECT_EQ(1000U, hashes.size());
+    EXPECT_EQ(1U, addresses.count(ndgpp::net::ipv6_address {0x20010db800000000, 5}));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <libndgpp/net/internet_checksum.hpp>
+
+namespace
+{
+    uint16_t reference_checksum(uint8_t const * const data, const std::size_t size)
+    {
+        uint32_t sum = 0;
+        for (std::size_t i = 0; i < size; i += 2)
+        {
+            const uint32_t high = data[i];
+            const uint32_t low = i + 1 < size ? data[i + 1] : 0;
+            sum += high << 8 | low;
+            sum = (sum & 0xffff) + (sum >> 16);
+        }
+
+        return static_cast<uint16_t>(~sum);
+    }
+}
+
+TEST(internet_checksum, rfc1071_example)
+{
+    const std::array<uint8_t, 8> data = {0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7};
+    EXPECT_EQ(0xddf2, ndgpp::net::ones_complement_sum(data.data(), data.size()));
+    EXPECT_EQ(0x220d, ndgpp::net::internet_checksum(data.data(), data.size()));
+}
+
+TEST(internet_checksum, ipv4_header)
+{
+    std::array<uint8_t, 20> header = {0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+                                      0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01, 0xc0, 0xa8, 0x00, 0xc7};
+
+    const ndgpp::network_byte_order<uint16_t> checksum = ndgpp::net::internet_checksum(header.data(), header.size());
+    EXPECT_EQ(0xb861, checksum);
+
+    std::memcpy(header.data() + 10, &checksum, checksum.size());
+    EXPECT_EQ(0, ndgpp::net::internet_checksum(header.data(), header.size()));
+}
+
+TEST(internet_checksum, matches_reference)
+{
+    std::mt19937 engine {1071};
+    std::uniform_int_distribution<unsigned> distribution {0, 255};
+    std::vector<uint8_t> data(4099);
+    for (auto & byte: data)
+    {
+        byte = static_cast<uint8_t>(distribution(engine));
+    }
+
+    for (std::size_t offset = 0; offset < 4; ++offset)
+    {
+        for (std::size_t size = 0; size < 80; ++size)
+        {
+            EXPECT_EQ(reference_checksum(data.data() + offset, size),
+                      ndgpp::net::internet_checksum(data.data() + offset, size)) << offset << ' ' << size;
+        }
+
+        const std::size_t size = data.size() - offset;
+        EXPECT_EQ(reference_checksum(data.data() + offset, size),
+                  ndgpp::net::internet_checksum(data.data() + offset, size));
+    }
+}
+
+TEST(internet_checksum, chained_sum)
+{
+    const std::array<uint8_t, 8> data = {0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7};
+    const auto first = ndgpp::net::ones_complement_sum(data.data(), 4);
+    const auto both = ndgpp::net::ones_complement_sum(data.data() + 4, 4, first);
+    EXPECT_EQ(ndgpp::net::ones_complement_sum(data.data(), data.size()), both);
+}
+
+TEST(internet_checksum_update, uint16)
+{
+    std::array<uint8_t, 20> header = {0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+                                      0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01, 0xc0, 0xa8, 0x00, 0xc7};
+    const auto checksum = ndgpp::net::internet_checksum(header.data(), header.size());
+
+    // Decrement the TTL
+    ndgpp::network_byte_order<uint16_t> old_value;
+    std::memcpy(&old_value, header.data() + 8, old_value.size());
+    const ndgpp::network_byte_order<uint16_t> new_value {0x3f11};
+    std::memcpy(header.data() + 8, &new_value, new_value.size());
+
+    EXPECT_EQ(ndgpp::net::internet_checksum(header.data(), header.size()),
+              ndgpp::net::internet_checksum_update(checksum, old_value, new_value));
+}
+
+TEST(internet_checksum_update, uint32)
+{
+    std::array<uint8_t, 20> header = {0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+                                      0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01, 0xc0, 0xa8, 0x00, 0xc7};
+    const auto checksum = ndgpp::net::internet_checksum(header.data(), header.size());
+
+    // Rewrite the source address
+    ndgpp::network_byte_order<uint32_t> old_value;
+    std::memcpy(&old_value, header.data() + 12, old_value.size());
+    const ndgpp::network_byte_order<uint32_t> new_value {0x0afffe01};
+    std::memcpy(header.data() + 12, &new_value, new_value.size());
+
+    EXPECT_EQ(ndgpp::net::internet_checksum(header.data(), header.size()),
+              ndgpp::net::internet_checksum_update(checksum, old_value, new_value));
+}
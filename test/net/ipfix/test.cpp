@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipfix.hpp>
+#include <libndgpp/net/ipfix_file_sink.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/port.hpp>
+#include <libndgpp/network_byte_order.hpp>
+
+namespace
+{
+    using flow_template = ndgpp::net::ipfix_template<256,
+                                                     ndgpp::net::ipfix_field<8, ndgpp::net::ipv4_address>,
+                                                     ndgpp::net::ipfix_field<7, ndgpp::net::port>,
+                                                     ndgpp::net::ipfix_field<1, ndgpp::network_byte_order<uint64_t>>>;
+
+    struct vector_sink
+    {
+        void write(uint8_t const * const data, const std::size_t size)
+        {
+            messages.emplace_back(data, data + size);
+        }
+
+        std::vector<std::vector<uint8_t>> messages;
+    };
+
+    uint16_t get16(const std::vector<uint8_t> & msg, const std::size_t offset)
+    {
+        return static_cast<uint16_t>(msg[offset] << 8 | msg[offset + 1]);
+    }
+
+    uint32_t get32(const std::vector<uint8_t> & msg, const std::size_t offset)
+    {
+        return static_cast<uint32_t>(get16(msg, offset)) << 16 | get16(msg, offset + 2);
+    }
+
+    flow_template::record_type make_record(const uint8_t i)
+    {
+        return flow_template::record_type {ndgpp::net::ipv4_address {std::array<uint8_t, 4> {{192, 168, 0, i}}},
+                                           ndgpp::net::port {static_cast<uint16_t>(i)},
+                                           ndgpp::network_byte_order<uint64_t> {i}};
+    }
+
+    constexpr std::size_t first_records_offset = ndgpp::net::ipfix_message_header_size + flow_template::template_set_size + ndgpp::net::ipfix_set_header_size;
+}
+
+TEST(ipfix_template, template_set)
+{
+    std::array<uint8_t, flow_template::template_set_size> buf;
+    flow_template::write_template_set(buf.data());
+
+    const std::array<uint8_t, 20> expected {{0, 2, 0, 20,
+                                             0x01, 0x00, 0, 3,
+                                             0, 8, 0, 4,
+                                             0, 7, 0, 2,
+                                             0, 1, 0, 8}};
+    EXPECT_EQ(expected, buf);
+}
+
+TEST(ipfix_encoder, first_message)
+{
+    vector_sink sink;
+    ndgpp::net::ipfix_encoder<flow_template, vector_sink> encoder {sink, 42};
+
+    encoder.add(make_record(1));
+    encoder.add(make_record(2));
+    EXPECT_EQ(2U, encoder.buffered());
+    EXPECT_TRUE(sink.messages.empty());
+
+    encoder.flush();
+    ASSERT_EQ(1U, sink.messages.size());
+    EXPECT_EQ(0U, encoder.buffered());
+    EXPECT_EQ(2U, encoder.sequence_number());
+
+    const std::vector<uint8_t> & msg = sink.messages[0];
+    ASSERT_EQ(first_records_offset + 2 * flow_template::record_size, msg.size());
+    EXPECT_EQ(10, get16(msg, 0));
+    EXPECT_EQ(msg.size(), get16(msg, 2));
+    EXPECT_EQ(0U, get32(msg, 8));
+    EXPECT_EQ(42U, get32(msg, 12));
+
+    // Template set
+    EXPECT_EQ(2, get16(msg, 16));
+    EXPECT_EQ(256, get16(msg, 20));
+
+    // Data set
+    const std::size_t data_set = ndgpp::net::ipfix_message_header_size + flow_template::template_set_size;
+    EXPECT_EQ(256, get16(msg, data_set));
+    EXPECT_EQ(ndgpp::net::ipfix_set_header_size + 2 * flow_template::record_size, get16(msg, data_set + 2));
+    EXPECT_EQ(make_record(1), flow_template::codec_type::decode(msg.data() + first_records_offset));
+    EXPECT_EQ(make_record(2), flow_template::codec_type::decode(msg.data() + first_records_offset + flow_template::record_size));
+}
+
+TEST(ipfix_encoder, flush_empty)
+{
+    vector_sink sink;
+    ndgpp::net::ipfix_encoder<flow_template, vector_sink> encoder {sink, 1};
+    encoder.flush();
+    EXPECT_TRUE(sink.messages.empty());
+}
+
+TEST(ipfix_encoder, full_message_is_sent)
+{
+    vector_sink sink;
+    const std::size_t max_size = first_records_offset + 3 * flow_template::record_size;
+    ndgpp::net::ipfix_encoder<flow_template, vector_sink> encoder {sink, 1, max_size};
+
+    for (uint8_t i = 0; i < 5; ++i)
+    {
+        encoder.add(make_record(i));
+    }
+
+    ASSERT_EQ(1U, sink.messages.size());
+    EXPECT_EQ(max_size, sink.messages[0].size());
+    EXPECT_EQ(2U, encoder.buffered());
+
+    encoder.flush();
+    ASSERT_EQ(2U, sink.messages.size());
+
+    // The second message does not carry the template
+    const std::vector<uint8_t> & msg = sink.messages[1];
+    EXPECT_EQ(3U, get32(msg, 8));
+    EXPECT_EQ(256, get16(msg, ndgpp::net::ipfix_message_header_size));
+    EXPECT_EQ(ndgpp::net::ipfix_message_header_size + ndgpp::net::ipfix_set_header_size + 2 * flow_template::record_size, msg.size());
+    EXPECT_EQ(make_record(3), flow_template::codec_type::decode(msg.data() + ndgpp::net::ipfix_message_header_size + ndgpp::net::ipfix_set_header_size));
+}
+
+TEST(ipfix_encoder, template_refresh)
+{
+    vector_sink sink;
+    ndgpp::net::ipfix_encoder<flow_template, vector_sink> encoder {sink, 1, 1472, 2};
+
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        encoder.add(make_record(i));
+        encoder.flush();
+    }
+
+    encoder.refresh_template();
+    encoder.add(make_record(4));
+    encoder.flush();
+
+    ASSERT_EQ(5U, sink.messages.size());
+    EXPECT_EQ(2, get16(sink.messages[0], 16));
+    EXPECT_EQ(256, get16(sink.messages[1], 16));
+    EXPECT_EQ(2, get16(sink.messages[2], 16));
+    EXPECT_EQ(256, get16(sink.messages[3], 16));
+    EXPECT_EQ(2, get16(sink.messages[4], 16));
+}
+
+TEST(ipfix_encoder, max_message_size_too_small)
+{
+    vector_sink sink;
+    using encoder_type = ndgpp::net::ipfix_encoder<flow_template, vector_sink>;
+    EXPECT_THROW(encoder_type(sink, 1, first_records_offset + flow_template::record_size - 1), ndgpp::error<std::invalid_argument>);
+}
+
+TEST(ipfix_file_sink, write)
+{
+    char path[] = "/tmp/libndgpp-ipfix-XXXXXX";
+    const int fd = ::mkstemp(path);
+    ASSERT_NE(-1, fd);
+    ::close(fd);
+
+    {
+        ndgpp::net::ipfix_file_sink sink {path};
+        ndgpp::net::ipfix_encoder<flow_template, ndgpp::net::ipfix_file_sink> encoder {sink, 7};
+        encoder.add(make_record(1));
+        encoder.flush();
+        encoder.add(make_record(2));
+        encoder.flush();
+    }
+
+    std::ifstream file {path, std::ios::binary};
+    const std::vector<uint8_t> contents {std::istreambuf_iterator<char> {file}, std::istreambuf_iterator<char> {}};
+    ::unlink(path);
+
+    const std::size_t first_size = first_records_offset + flow_template::record_size;
+    ASSERT_EQ(first_size + ndgpp::net::ipfix_message_header_size + ndgpp::net::ipfix_set_header_size + flow_template::record_size,
+              contents.size());
+    EXPECT_EQ(first_size, get16(contents, 2));
+    EXPECT_EQ(1U, get32(contents, first_size + 8));
+}
+
+TEST(ipfix_file_sink, open_failure)
+{
+    EXPECT_THROW(ndgpp::net::ipfix_file_sink {"/nonexistent/dir/file.ipfix"}, ndgpp::error<std::system_error>);
+}
@@ -0,0 +1,125 @@
+#include <arpa/inet.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_endpoint.hpp>
+
+namespace
+{
+    ndgpp::net::ipv4_endpoint_parse_result parse(const std::string & value)
+    {
+        return ndgpp::net::parse_ipv4_endpoint(value.data(), value.data() + value.size());
+    }
+}
+
+TEST(ipv4_endpoint, packed)
+{
+    static_assert(sizeof(ndgpp::net::ipv4_endpoint) == sizeof(uint64_t), "");
+    static_assert(std::is_trivially_copyable<ndgpp::net::ipv4_endpoint>::value, "");
+
+    constexpr ndgpp::net::ipv4_endpoint endpoint {ndgpp::net::ipv4_address {0xc0000201}, ndgpp::net::port {std::integral_constant<uint16_t, 8080> {}}};
+    static_assert(endpoint.to_uint64() == (uint64_t {0xc0000201} << 16 | 8080), "");
+    static_assert(endpoint.address().to_uint32() == 0xc0000201, "");
+    EXPECT_EQ(8080, endpoint.port().value());
+
+    constexpr ndgpp::net::ipv4_endpoint empty {};
+    EXPECT_EQ(0U, empty.to_uint64());
+}
+
+TEST(ipv4_endpoint, string)
+{
+    const ndgpp::net::ipv4_endpoint endpoint {std::string {"192.0.2.1:8080"}};
+    EXPECT_EQ(ndgpp::net::ipv4_address {std::string {"192.0.2.1"}}, endpoint.address());
+    EXPECT_EQ(8080, endpoint.port().value());
+    EXPECT_EQ("192.0.2.1:8080", endpoint.to_string());
+
+    EXPECT_EQ("0.0.0.0:0", ndgpp::net::ipv4_endpoint {}.to_string());
+    EXPECT_EQ("255.255.255.255:65535", ndgpp::net::ipv4_endpoint {std::string {"255.255.255.255:65535"}}.to_string());
+
+    EXPECT_THROW(ndgpp::net::ipv4_endpoint {std::string {"192.0.2.1"}}, ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(ndgpp::net::ipv4_endpoint {std::string {"192.0.2.1:80 "}}, ndgpp::error<std::invalid_argument>);
+}
+
+TEST(ipv4_endpoint, parse)
+{
+    const std::string value {"10.0.0.1:53,10.0.0.2:53"};
+    const ndgpp::net::ipv4_endpoint_parse_result result = ndgpp::net::parse_ipv4_endpoint(value.data(), value.data() + value.size());
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(value.data() + 11, result.unparsed());
+    EXPECT_EQ("10.0.0.1:53", result.value().to_string());
+
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::invalid_address, parse("10.0.0:53").error());
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::expected_colon, parse("10.0.0.1").error());
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::expected_colon, parse("10.0.0.1/53").error());
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::expected_digit, parse("10.0.0.1:").error());
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::expected_digit, parse("10.0.0.1:x").error());
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::port_out_of_range, parse("10.0.0.1:65536").error());
+    EXPECT_EQ(ndgpp::net::ipv4_endpoint_parse_errc::port_out_of_range, parse("10.0.0.1:123456").error());
+    EXPECT_THROW(parse("10.0.0.1:").value(), ndgpp::error<std::logic_error>);
+}
+
+TEST(ipv4_endpoint, to_chars)
+{
+    const ndgpp::net::ipv4_endpoint endpoint {std::string {"172.16.0.1:443"}};
+
+    char buffer[ndgpp::net::ipv4_endpoint::max_chars];
+    const ndgpp::to_chars_result small = ndgpp::net::to_chars(buffer, buffer + 13, endpoint);
+    EXPECT_EQ(std::errc::value_too_large, small.ec);
+    EXPECT_EQ(buffer + 13, small.ptr);
+
+    const ndgpp::to_chars_result exact = ndgpp::net::to_chars(buffer, buffer + 14, endpoint);
+    EXPECT_EQ(std::errc {}, exact.ec);
+    EXPECT_EQ("172.16.0.1:443", std::string(buffer, exact.ptr));
+
+    std::ostringstream stream;
+    stream << endpoint;
+    EXPECT_EQ("172.16.0.1:443", stream.str());
+}
+
+TEST(ipv4_endpoint, sockaddr)
+{
+    const ndgpp::net::ipv4_endpoint endpoint {std::string {"192.0.2.1:8080"}};
+    const sockaddr_in address = endpoint.to_sockaddr();
+    EXPECT_EQ(AF_INET, address.sin_family);
+    EXPECT_EQ(htons(8080), address.sin_port);
+    EXPECT_EQ(inet_addr("192.0.2.1"), address.sin_addr.s_addr);
+
+    EXPECT_EQ(endpoint, ndgpp::net::ipv4_endpoint {address});
+
+    sockaddr_in other = address;
+    other.sin_family = AF_INET6;
+    EXPECT_THROW(ndgpp::net::ipv4_endpoint {other}, ndgpp::error<std::invalid_argument>);
+}
+
+TEST(ipv4_endpoint, ordering_and_hash)
+{
+    const ndgpp::net::ipv4_endpoint a {std::string {"10.0.0.1:65535"}};
+    const ndgpp::net::ipv4_endpoint b {std::string {"10.0.0.2:1"}};
+    const ndgpp::net::ipv4_endpoint c {std::string {"10.0.0.2:2"}};
+
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b < c);
+    EXPECT_TRUE(c > a);
+    EXPECT_TRUE(a <= a);
+    EXPECT_TRUE(a >= a);
+    EXPECT_TRUE(a != b);
+
+    std::unordered_set<ndgpp::net::ipv4_endpoint> endpoints;
+    std::unordered_set<std::size_t> hashes;
+    for (uint16_t port = 0; port < 1000; ++port)
+    {
+        const ndgpp::net::ipv4_endpoint endpoint {ndgpp::net::ipv4_address {0x0a000001}, ndgpp::net::port {port}};
+        endpoints.insert(endpoint);
+        hashes.insert(std::hash<ndgpp::net::ipv4_endpoint> {} (endpoint));
+    }
+
+    EXPECT_EQ(1000U, endpoints.size());
+    EXPECT_EQ(1000U, hashes.size());
+}
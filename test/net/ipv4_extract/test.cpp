@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/ipv4_extract.hpp>
+
+namespace
+{
+    std::vector<uint32_t> extract(const std::string & text)
+    {
+        std::vector<uint32_t> out(text.size());
+        const auto result = ndgpp::net::extract_ipv4_addresses(text.data(), text.data() + text.size(), out.data(), out.size());
+        EXPECT_EQ(text.data() + text.size(), result.unparsed);
+        out.resize(result.count);
+        return out;
+    }
+
+    bool is_token(const char c)
+    {
+        return (c >= '0' && c <= '9') || c == '.';
+    }
+
+    /// Extracts addresses one run at a time with the string parser
+    std::vector<uint32_t> reference_extract(const std::string & text)
+    {
+        std::vector<uint32_t> out;
+        std::size_t i = 0;
+        while (i < text.size())
+        {
+            if (!is_token(text[i]))
+            {
+                ++i;
+                continue;
+            }
+
+            std::size_t j = i;
+            while (j < text.size() && is_token(text[j]))
+            {
+                ++j;
+            }
+
+            std::string run = text.substr(i, j - i);
+            run.erase(0, run.find_first_not_of('.'));
+            if (!run.empty() && run.back() == '.')
+            {
+                run.pop_back();
+            }
+
+            // A dotted quad has exactly three periods and octets of one to three digits
+            std::size_t dots = 0;
+            std::size_t digits = 0;
+            bool valid = !run.empty();
+            for (const char c: run)
+            {
+                if (c == '.')
+                {
+                    valid = valid && digits > 0;
+                    digits = 0;
+                    ++dots;
+                }
+                else
+                {
+                    ++digits;
+                    valid = valid && digits <= 3;
+                }
+            }
+
+            if (valid && dots == 3 && digits > 0)
+            {
+                try
+                {
+                    out.push_back(ndgpp::net::ipv4_address {run}.to_uint32());
+                }
+                catch (const std::exception &)
+                {}
+            }
+
+            i = j;
+        }
+
+        return out;
+    }
+}
+
+TEST(ipv4_extract, log_line)
+{
+    const std::string text = "Oct 18 12:00:01 fw drop src=10.1.2.3 dst=192.168.0.254:443 proto=6";
+    EXPECT_EQ((std::vector<uint32_t> {0x0a010203, 0xc0a800fe}), extract(text));
+}
+
+TEST(ipv4_extract, boundaries)
+{
+    EXPECT_EQ((std::vector<uint32_t> {0x01020304}), extract("1.2.3.4"));
+    EXPECT_EQ((std::vector<uint32_t> {0x01020304}), extract("connect to 1.2.3.4."));
+    EXPECT_EQ((std::vector<uint32_t> {}), extract("version 1.2.3.4.5"));
+    EXPECT_EQ((std::vector<uint32_t> {}), extract("1.2.3.256 1.2.3 1234.1.1.1"));
+    EXPECT_EQ((std::vector<uint32_t> {0x0a000001, 0x0a000002}), extract("10.0.0.1,10.0.0.2"));
+    EXPECT_EQ((std::vector<uint32_t> {}), extract(""));
+}
+
+TEST(ipv4_extract, array_and_address_output)
+{
+    const std::string text = "a 255.0.0.1 b";
+
+    std::array<ndgpp::net::ipv4_array, 4> arrays;
+    const auto array_result = ndgpp::net::extract_ipv4_addresses(text.data(), text.data() + text.size(), arrays.data(), arrays.size());
+    ASSERT_EQ(1U, array_result.count);
+    EXPECT_EQ((ndgpp::net::ipv4_array {{255, 0, 0, 1}}), arrays[0]);
+
+    std::array<ndgpp::net::ipv4_address, 4> addrs;
+    const auto addr_result = ndgpp::net::extract_ipv4_addresses(text.data(), text.data() + text.size(), addrs.data(), addrs.size());
+    ASSERT_EQ(1U, addr_result.count);
+    EXPECT_EQ(ndgpp::net::ipv4_address {std::string {"255.0.0.1"}}, addrs[0]);
+}
+
+TEST(ipv4_extract, resume_when_full)
+{
+    std::string text;
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        text += "x 10.0." + std::to_string(i / 256) + '.' + std::to_string(i % 256) + ' ';
+    }
+
+    std::vector<uint32_t> all;
+    char const * position = text.data();
+    char const * const last = text.data() + text.size();
+    while (position != last)
+    {
+        std::array<uint32_t, 7> out;
+        const auto result = ndgpp::net::extract_ipv4_addresses(position, last, out.data(), out.size());
+        all.insert(all.end(), out.begin(), out.begin() + result.count);
+        position = result.unparsed;
+    }
+
+    ASSERT_EQ(200U, all.size());
+    for (uint32_t i = 0; i < all.size(); ++i)
+    {
+        EXPECT_EQ(0x0a000000 + i, all[i]);
+    }
+}
+
+TEST(ipv4_extract, matches_reference)
+{
+    std::mt19937 gen {11};
+    const std::string alphabet = "0123456789012345678901234567890123456789.......  :,x/";
+    std::uniform_int_distribution<std::size_t> char_dist {0, alphabet.size() - 1};
+    std::uniform_int_distribution<unsigned int> octet_dist {0, 270};
+
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string text;
+        for (int j = 0; j < 200; ++j)
+        {
+            if (j % 8 == 0)
+            {
+                text += std::to_string(octet_dist(gen)) + '.' + std::to_string(octet_dist(gen)) + '.' +
+                        std::to_string(octet_dist(gen)) + '.' + std::to_string(octet_dist(gen));
+            }
+
+            text.push_back(alphabet[char_dist(gen)]);
+        }
+
+        EXPECT_EQ(reference_extract(text), extract(text)) << text;
+    }
+}
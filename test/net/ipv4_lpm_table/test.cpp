@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_lpm_table.hpp>
+
+namespace
+{
+    ndgpp::net::ipv4_network net(const std::string & value)
+    {
+        return ndgpp::net::ipv4_network {value};
+    }
+
+    uint32_t addr(const std::string & value)
+    {
+        return ndgpp::net::ipv4_address {value}.to_uint32();
+    }
+
+    /// Finds the longest matching prefix by checking every prefix
+    uint32_t reference_lookup(const std::map<ndgpp::net::ipv4_network, uint32_t> & prefixes, const uint32_t address)
+    {
+        int best_length = -1;
+        uint32_t best = ndgpp::net::ipv4_lpm_table::no_match;
+        for (const auto & prefix: prefixes)
+        {
+            const int length = prefix.first.prefix_length().value();
+            if (prefix.first.contains(ndgpp::net::ipv4_address {address}) && length > best_length)
+            {
+                best_length = length;
+                best = prefix.second;
+            }
+        }
+
+        return best;
+    }
+}
+
+TEST(ipv4_lpm_table, empty)
+{
+    const ndgpp::net::ipv4_lpm_table table;
+    EXPECT_EQ(0U, table.size());
+    EXPECT_EQ(ndgpp::net::ipv4_lpm_table::no_match, table.lookup(addr("10.0.0.1")));
+}
+
+TEST(ipv4_lpm_table, longest_match)
+{
+    ndgpp::net::ipv4_lpm_table table;
+    table.insert(net("0.0.0.0/0"), 0);
+    table.insert(net("10.0.0.0/8"), 1);
+    table.insert(net("10.1.0.0/16"), 2);
+    table.insert(net("10.1.2.128/25"), 3);
+    table.insert(net("10.1.2.130/32"), 4);
+
+    EXPECT_EQ(5U, table.size());
+    EXPECT_EQ(0U, table.lookup(addr("192.168.0.1")));
+    EXPECT_EQ(1U, table.lookup(addr("10.2.0.1")));
+    EXPECT_EQ(2U, table.lookup(addr("10.1.2.1")));
+    EXPECT_EQ(3U, table.lookup(addr("10.1.2.129")));
+    EXPECT_EQ(4U, table.lookup(addr("10.1.2.130")));
+    EXPECT_EQ(3U, table.lookup(ndgpp::net::ipv4_address {std::string {"10.1.2.255"}}));
+}
+
+TEST(ipv4_lpm_table, insert_shorter_after_longer)
+{
+    ndgpp::net::ipv4_lpm_table table;
+    table.insert(net("10.1.2.0/26"), 3);
+    table.insert(net("10.1.0.0/16"), 2);
+    table.insert(net("10.0.0.0/8"), 1);
+
+    EXPECT_EQ(3U, table.lookup(addr("10.1.2.1")));
+    EXPECT_EQ(2U, table.lookup(addr("10.1.2.64")));
+    EXPECT_EQ(1U, table.lookup(addr("10.2.0.0")));
+}
+
+TEST(ipv4_lpm_table, replace_value)
+{
+    ndgpp::net::ipv4_lpm_table table;
+    table.insert(net("10.0.0.0/8"), 1);
+    table.insert(net("10.0.0.0/8"), 7);
+    EXPECT_EQ(1U, table.size());
+    EXPECT_EQ(7U, table.lookup(addr("10.0.0.1")));
+}
+
+TEST(ipv4_lpm_table, erase)
+{
+    ndgpp::net::ipv4_lpm_table table;
+    table.insert(net("10.0.0.0/8"), 1);
+    table.insert(net("10.1.0.0/16"), 2);
+    table.insert(net("10.1.2.128/25"), 3);
+
+    EXPECT_TRUE(table.erase(net("10.1.0.0/16")));
+    EXPECT_FALSE(table.erase(net("10.1.0.0/16")));
+    EXPECT_EQ(1U, table.lookup(addr("10.1.2.1")));
+    EXPECT_EQ(3U, table.lookup(addr("10.1.2.129")));
+
+    EXPECT_TRUE(table.erase(net("10.1.2.128/25")));
+    EXPECT_EQ(1U, table.lookup(addr("10.1.2.129")));
+
+    EXPECT_TRUE(table.erase(net("10.0.0.0/8")));
+    EXPECT_EQ(ndgpp::net::ipv4_lpm_table::no_match, table.lookup(addr("10.1.2.129")));
+    EXPECT_EQ(0U, table.size());
+}
+
+TEST(ipv4_lpm_table, value_out_of_range)
+{
+    ndgpp::net::ipv4_lpm_table table;
+    EXPECT_THROW(table.insert(net("10.0.0.0/8"), ndgpp::net::ipv4_lpm_table::max_value + 1), ndgpp::error<std::out_of_range>);
+}
+
+TEST(ipv4_lpm_table, matches_reference)
+{
+    std::mt19937 gen {5};
+    std::uniform_int_distribution<unsigned int> length_dist {0, 32};
+    std::uniform_int_distribution<uint32_t> value_dist {0, 1000};
+
+    // Prefixes are drawn under 10.0.0.0/14 so they overlap
+    auto random_address = [&gen] () {
+        return 0x0a000000 | (static_cast<uint32_t>(gen()) & 0x0003ffff);
+    };
+
+    ndgpp::net::ipv4_lpm_table table;
+    std::map<ndgpp::net::ipv4_network, uint32_t> prefixes;
+    std::vector<uint32_t> addresses;
+    for (int i = 0; i < 2000; ++i)
+    {
+        addresses.push_back(random_address());
+    }
+
+    for (int round = 0; round < 400; ++round)
+    {
+        unsigned int length = length_dist(gen);
+        length = length < 8 ? length + 14 : length;
+        const ndgpp::net::ipv4_network network {ndgpp::net::ipv4_address {random_address()},
+                                                ndgpp::net::ipv4_prefix_length {length}};
+
+        if (round % 3 == 2 && !prefixes.empty())
+        {
+            auto iter = prefixes.begin();
+            std::advance(iter, gen() % prefixes.size());
+            EXPECT_TRUE(table.erase(iter->first));
+            prefixes.erase(iter);
+        }
+        else
+        {
+            const uint32_t value = value_dist(gen);
+            table.insert(network, value);
+            prefixes[network] = value;
+        }
+
+        ASSERT_EQ(prefixes.size(), table.size());
+    }
+
+    std::vector<uint32_t> values(addresses.size());
+    table.lookup(addresses.data(), addresses.size(), values.data());
+    for (std::size_t i = 0; i < addresses.size(); ++i)
+    {
+        ASSERT_EQ(reference_lookup(prefixes, addresses[i]), values[i]);
+        ASSERT_EQ(values[i], table.lookup(addresses[i]));
+    }
+
+    while (!prefixes.empty())
+    {
+        EXPECT_TRUE(table.erase(prefixes.begin()->first));
+        prefixes.erase(prefixes.begin());
+    }
+
+    for (const uint32_t address: addresses)
+    {
+        ASSERT_EQ(ndgpp::net::ipv4_lpm_table::no_match, table.lookup(address));
+    }
+}
+
+TEST(ipv4_lpm_table, batch_addresses)
+{
+    ndgpp::net::ipv4_lpm_table table;
+    table.insert(net("192.168.0.0/16"), 5);
+
+    const std::vector<ndgpp::net::ipv4_address> addresses {ndgpp::net::ipv4_address {std::string {"192.168.1.1"}},
+                                                           ndgpp::net::ipv4_address {std::string {"10.0.0.1"}}};
+    std::vector<uint32_t> values(addresses.size());
+    table.lookup(addresses.data(), addresses.size(), values.data());
+    EXPECT_EQ(5U, values[0]);
+    EXPECT_EQ(ndgpp::net::ipv4_lpm_table::no_match, values[1]);
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_network.hpp>
+
+namespace
+{
+    ndgpp::net::ipv4_address addr(const std::string & value)
+    {
+        return ndgpp::net::ipv4_address {value};
+    }
+
+    ndgpp::net::ipv4_network net(const std::string & value)
+    {
+        return ndgpp::net::ipv4_network {value};
+    }
+
+    constexpr ndgpp::net::ipv4_network ten {ndgpp::net::ipv4_address {0x0a000000u},
+                                           ndgpp::net::ipv4_prefix_length {std::integral_constant<uint8_t, 8> {}}};
+}
+
+TEST(ipv4_network, constexpr_members)
+{
+    static_assert(ten.contains(ndgpp::net::ipv4_address {0x0a123456u}), "");
+    static_assert(!ten.contains(ndgpp::net::ipv4_address {0x0b000000u}), "");
+    static_assert(ten.size() == 0x1000000, "");
+    static_assert(ten.broadcast().to_uint32() == 0x0affffff, "");
+    static_assert(ten.netmask().to_uint32() == 0xff000000, "");
+    SUCCEED();
+}
+
+TEST(ipv4_network, default_ctor)
+{
+    const ndgpp::net::ipv4_network all;
+    EXPECT_EQ(0U, all.prefix_length().value());
+    EXPECT_EQ(0U, all.mask());
+    EXPECT_EQ(uint64_t {1} << 32, all.size());
+    EXPECT_TRUE(all.contains(addr("255.255.255.255")));
+    EXPECT_EQ(addr("255.255.255.255"), all.broadcast());
+}
+
+TEST(ipv4_network, parse)
+{
+    const ndgpp::net::ipv4_network network = net("192.168.10.0/24");
+    EXPECT_EQ(addr("192.168.10.0"), network.network());
+    EXPECT_EQ(24U, network.prefix_length().value());
+    EXPECT_EQ(addr("255.255.255.0"), network.netmask());
+    EXPECT_EQ(addr("192.168.10.255"), network.broadcast());
+    EXPECT_EQ(256U, network.size());
+    EXPECT_EQ("192.168.10.0/24", network.to_string());
+}
+
+TEST(ipv4_network, host_bits_are_cleared)
+{
+    EXPECT_EQ(net("10.0.0.0/8"), net("10.1.2.3/8"));
+    EXPECT_EQ(addr("10.1.2.3"), net("10.1.2.3/32").network());
+}
+
+TEST(ipv4_network, parse_errors)
+{
+    EXPECT_THROW(net("10.0.0.0"), ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(net("10.0.0/8"), ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(net("10.0.0.0/33"), ndgpp::error<ndgpp::bounded_integer_overflow>);
+    EXPECT_THROW(net("10.0.0.0/x"), ndgpp::error<ndgpp::bounded_integer_invalid>);
+    EXPECT_THROW(net("1.2.3.4:/8"), ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(net("1.2.3.4/ 8"), ndgpp::error<ndgpp::bounded_integer_invalid>);
+    EXPECT_THROW(net("1.2.3.4/+8"), ndgpp::error<ndgpp::bounded_integer_invalid>);
+    EXPECT_THROW(net("1.2.3.4/8 "), ndgpp::error<ndgpp::bounded_integer_invalid>);
+    EXPECT_THROW(net("1.2.3.4/008"), ndgpp::error<ndgpp::bounded_integer_invalid>);
+    EXPECT_THROW(net("1.2.3.4/"), ndgpp::error<ndgpp::bounded_integer_invalid>);
+}
+
+TEST(ipv4_network, contains)
+{
+    const ndgpp::net::ipv4_network network = net("172.16.0.0/12");
+    EXPECT_TRUE(network.contains(addr("172.16.0.0")));
+    EXPECT_TRUE(network.contains(addr("172.31.255.255")));
+    EXPECT_FALSE(network.contains(addr("172.32.0.0")));
+    EXPECT_FALSE(network.contains(addr("172.15.255.255")));
+
+    EXPECT_TRUE(network.contains(net("172.20.0.0/16")));
+    EXPECT_TRUE(network.contains(network));
+    EXPECT_FALSE(network.contains(net("172.0.0.0/8")));
+    EXPECT_FALSE(network.contains(net("10.0.0.0/16")));
+}
+
+TEST(ipv4_network, supernet)
+{
+    EXPECT_EQ(net("10.0.0.0/23"), net("10.0.1.0/24").supernet());
+    EXPECT_EQ(net("10.0.0.0/8"), net("10.1.2.0/24").supernet(ndgpp::net::ipv4_prefix_length {8}));
+    EXPECT_THROW(net("0.0.0.0/0").supernet(), ndgpp::error<std::out_of_range>);
+    EXPECT_THROW(net("10.0.0.0/8").supernet(ndgpp::net::ipv4_prefix_length {16}), ndgpp::error<std::out_of_range>);
+}
+
+TEST(ipv4_network, subnet)
+{
+    const ndgpp::net::ipv4_network network = net("10.0.0.0/8");
+    const ndgpp::net::ipv4_prefix_length sixteen {16};
+
+    EXPECT_EQ(256U, network.subnet_count(sixteen));
+    EXPECT_EQ(0U, network.subnet_count(ndgpp::net::ipv4_prefix_length {4}));
+    EXPECT_EQ(net("10.0.0.0/16"), network.subnet(sixteen));
+    EXPECT_EQ(net("10.255.0.0/16"), network.subnet(sixteen, 255));
+    EXPECT_THROW(network.subnet(sixteen, 256), ndgpp::error<std::out_of_range>);
+    EXPECT_THROW(network.subnet(ndgpp::net::ipv4_prefix_length {4}), ndgpp::error<std::out_of_range>);
+
+    EXPECT_EQ(net("0.0.0.0/0"), net("0.0.0.0/0").subnet(ndgpp::net::ipv4_prefix_length {0}));
+    EXPECT_EQ(net("255.255.255.255/32"), net("0.0.0.0/0").subnet(ndgpp::net::ipv4_prefix_length {32}, 0xffffffff));
+}
+
+TEST(ipv4_network, ordering)
+{
+    EXPECT_LT(net("10.0.0.0/8"), net("10.0.0.0/16"));
+    EXPECT_LT(net("10.0.0.0/16"), net("10.1.0.0/16"));
+    EXPECT_NE(net("10.0.0.0/8"), net("10.0.0.0/16"));
+}
+
+TEST(ipv4_network, to_chars_and_ostream)
+{
+    std::array<char, 18> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), net("255.255.255.255/32"));
+    ASSERT_EQ(std::errc {}, result.ec);
+    EXPECT_EQ("255.255.255.255/32", std::string(buffer.data(), result.ptr));
+
+    EXPECT_EQ(std::errc::value_too_large, ndgpp::net::to_chars(buffer.data(), buffer.data() + 8, net("10.0.0.0/8")).ec);
+
+    std::stringstream ss;
+    ss << net("10.0.0.0/8");
+    EXPECT_EQ("10.0.0.0/8", ss.str());
+}
+
+TEST(ipv4_network, hash)
+{
+    std::unordered_set<ndgpp::net::ipv4_network> networks {net("10.0.0.0/8"), net("10.0.0.0/16"), net("10.1.2.3/8")};
+    EXPECT_EQ(2U, networks.size());
+}
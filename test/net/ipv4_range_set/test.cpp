@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_range_set.hpp>
+
+namespace
+{
+    using ndgpp::net::ipv4_range;
+    using ndgpp::net::ipv4_range_set;
+
+    /// A bitmap of the addresses in [0, universe) used as the reference set
+    constexpr uint32_t universe = 4096;
+
+    std::vector<bool> to_bitmap(const ipv4_range_set & set)
+    {
+        std::vector<bool> bitmap(universe);
+        for (uint32_t address = 0; address < universe; ++address)
+        {
+            bitmap[address] = set.contains(address);
+        }
+
+        return bitmap;
+    }
+
+    ipv4_range random_range(std::mt19937 & gen)
+    {
+        const uint32_t first = gen() % universe;
+        const uint32_t length = gen() % 64;
+        return ipv4_range {first, std::min(first + length, universe - 1)};
+    }
+
+    /// Returns true if the set's ranges are sorted, disjoint and not adjacent
+    bool coalesced(const ipv4_range_set & set)
+    {
+        for (std::size_t i = 1; i < set.size(); ++i)
+        {
+            if (uint64_t {set.ranges()[i - 1].last} + 1 >= set.ranges()[i].first)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+TEST(ipv4_range_set, empty)
+{
+    const ipv4_range_set set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(0U, set.address_count());
+    EXPECT_FALSE(set.contains(uint32_t {0}));
+    EXPECT_FALSE(set.contains(uint32_t {0xffffffff}));
+}
+
+TEST(ipv4_range_set, insert_coalesces)
+{
+    ipv4_range_set set;
+    set.insert(ipv4_range {10, 20});
+    set.insert(ipv4_range {30, 40});
+    EXPECT_EQ(2U, set.size());
+
+    set.insert(ipv4_range {21, 29});
+    ASSERT_EQ(1U, set.size());
+    EXPECT_EQ((ipv4_range {10, 40}), set.ranges()[0]);
+
+    set.insert(ipv4_range {5, 50});
+    ASSERT_EQ(1U, set.size());
+    EXPECT_EQ((ipv4_range {5, 50}), set.ranges()[0]);
+    EXPECT_EQ(46U, set.address_count());
+}
+
+TEST(ipv4_range_set, address_limits)
+{
+    ipv4_range_set set;
+    set.insert(ipv4_range {0xfffffff0, 0xffffffff});
+    set.insert(ipv4_range {0, 0});
+    EXPECT_TRUE(set.contains(uint32_t {0xffffffff}));
+    EXPECT_TRUE(set.contains(uint32_t {0}));
+    EXPECT_FALSE(set.contains(uint32_t {1}));
+
+    set.erase(ipv4_range {0xffffffff, 0xffffffff});
+    EXPECT_FALSE(set.contains(uint32_t {0xffffffff}));
+    EXPECT_TRUE(set.contains(uint32_t {0xfffffffe}));
+
+    set.insert(ipv4_range {0, 0xffffffff});
+    EXPECT_EQ(1U, set.size());
+    EXPECT_EQ(uint64_t {1} << 32, set.address_count());
+}
+
+TEST(ipv4_range_set, networks_and_addresses)
+{
+    ipv4_range_set set;
+    set.insert(ndgpp::net::ipv4_network {"10.0.0.0/8"});
+    set.insert(ndgpp::net::ipv4_address {std::string {"192.168.1.1"}});
+
+    EXPECT_TRUE(set.contains(ndgpp::net::ipv4_address {std::string {"10.255.0.1"}}));
+    EXPECT_TRUE(set.contains(ndgpp::net::ipv4_address {std::string {"192.168.1.1"}}));
+    EXPECT_FALSE(set.contains(ndgpp::net::ipv4_address {std::string {"192.168.1.2"}}));
+    EXPECT_TRUE(set.contains(ipv4_range {ndgpp::net::ipv4_network {"10.1.0.0/16"}}));
+    EXPECT_FALSE(set.contains(ipv4_range {ndgpp::net::ipv4_network {"10.0.0.0/7"}}));
+
+    set.erase(ndgpp::net::ipv4_network {"10.1.0.0/16"});
+    EXPECT_EQ(3U, set.size());
+    EXPECT_FALSE(set.contains(ndgpp::net::ipv4_address {std::string {"10.1.2.3"}}));
+    EXPECT_TRUE(set.contains(ndgpp::net::ipv4_address {std::string {"10.2.0.0"}}));
+    EXPECT_TRUE(set.contains(ndgpp::net::ipv4_address {std::string {"10.0.255.255"}}));
+}
+
+TEST(ipv4_range_set, invalid_range)
+{
+    ipv4_range_set set;
+    EXPECT_THROW(set.insert(ipv4_range {2, 1}), ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(set.erase(ipv4_range {2, 1}), ndgpp::error<std::invalid_argument>);
+
+    const ipv4_range ranges[] = {{1, 2}, {4, 3}};
+    EXPECT_THROW((ipv4_range_set {ranges, 2}), ndgpp::error<std::invalid_argument>);
+}
+
+TEST(ipv4_range_set, matches_reference)
+{
+    std::mt19937 gen {11};
+    ipv4_range_set set;
+    std::vector<bool> reference(universe);
+
+    for (int round = 0; round < 500; ++round)
+    {
+        const ipv4_range range = random_range(gen);
+        const bool insert = gen() % 3 != 0;
+        if (insert)
+        {
+            set.insert(range);
+        }
+        else
+        {
+            set.erase(range);
+        }
+
+        for (uint32_t address = range.first; address <= range.last; ++address)
+        {
+            reference[address] = insert;
+        }
+
+        ASSERT_TRUE(coalesced(set));
+        ASSERT_EQ(reference, to_bitmap(set));
+    }
+
+    std::vector<uint32_t> addresses(universe);
+    for (uint32_t address = 0; address < universe; ++address)
+    {
+        addresses[address] = address;
+    }
+
+    std::unique_ptr<bool[]> results {new bool[universe]};
+    set.contains(addresses.data(), addresses.size(), results.get());
+    for (uint32_t address = 0; address < universe; ++address)
+    {
+        ASSERT_EQ(reference[address], results[address]);
+    }
+}
+
+TEST(ipv4_range_set, bulk_insert)
+{
+    std::mt19937 gen {3};
+    std::vector<ipv4_range> ranges;
+    ipv4_range_set expected;
+    for (int i = 0; i < 300; ++i)
+    {
+        ranges.push_back(random_range(gen));
+        expected.insert(ranges.back());
+    }
+
+    const ipv4_range_set set {ranges.data(), ranges.size()};
+    EXPECT_TRUE(coalesced(set));
+    EXPECT_EQ(expected, set);
+
+    ipv4_range_set merged;
+    merged.insert(ipv4_range {0, 10});
+    merged.insert(ranges.data(), ranges.size());
+    expected.insert(ipv4_range {0, 10});
+    EXPECT_EQ(expected, merged);
+}
+
+TEST(ipv4_range_set, set_operations)
+{
+    std::mt19937 gen {7};
+    for (int round = 0; round < 20; ++round)
+    {
+        ipv4_range_set lhs;
+        ipv4_range_set rhs;
+        for (int i = 0; i < 40; ++i)
+        {
+            lhs.insert(random_range(gen));
+            rhs.insert(random_range(gen));
+        }
+
+        const std::vector<bool> lhs_bitmap = to_bitmap(lhs);
+        const std::vector<bool> rhs_bitmap = to_bitmap(rhs);
+
+        const ipv4_range_set union_set = set_union(lhs, rhs);
+        const ipv4_range_set intersection_set = set_intersection(lhs, rhs);
+        const ipv4_range_set difference_set = set_difference(lhs, rhs);
+        ASSERT_TRUE(coalesced(union_set));
+        ASSERT_TRUE(coalesced(intersection_set));
+        ASSERT_TRUE(coalesced(difference_set));
+
+        for (uint32_t address = 0; address < universe; ++address)
+        {
+            ASSERT_EQ(lhs_bitmap[address] || rhs_bitmap[address], union_set.contains(address));
+            ASSERT_EQ(lhs_bitmap[address] && rhs_bitmap[address], intersection_set.contains(address));
+            ASSERT_EQ(lhs_bitmap[address] && !rhs_bitmap[address], difference_set.contains(address));
+        }
+    }
+}
+
+TEST(ipv4_range_set, batch_addresses)
+{
+    ipv4_range_set set;
+    set.insert(ndgpp::net::ipv4_network {"172.16.0.0/12"});
+
+    const std::vector<ndgpp::net::ipv4_address> addresses {ndgpp::net::ipv4_address {std::string {"172.20.1.1"}},
+                                                           ndgpp::net::ipv4_address {std::string {"172.32.0.0"}}};
+    bool results[2];
+    set.contains(addresses.data(), addresses.size(), results);
+    EXPECT_TRUE(results[0]);
+    EXPECT_FALSE(results[1]);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/ipv4_array.hpp>
+
+namespace
+{
+    std::string reference_string(const ndgpp::net::ipv4_array value)
+    {
+        char buffer[16];
+        const int size = std::snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", value[0], value[1], value[2], value[3]);
+        return std::string(buffer, static_cast<std::size_t>(size));
+    }
+}
+
+TEST(ipv4_to_chars, every_octet)
+{
+    for (unsigned int i = 0; i < 256; ++i)
+    {
+        const ndgpp::net::ipv4_array value {{static_cast<uint8_t>(i), static_cast<uint8_t>(255 - i), static_cast<uint8_t>(i), 0}};
+        std::array<char, 32> buffer;
+        const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        ASSERT_EQ(std::errc {}, result.ec);
+        EXPECT_EQ(reference_string(value), std::string(buffer.data(), result.ptr));
+    }
+}
+
+TEST(ipv4_to_chars, exact_fit)
+{
+    const ndgpp::net::ipv4_array value {{255, 255, 255, 255}};
+    std::array<char, 16> buffer;
+    buffer.fill('x');
+
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + 15, value);
+    ASSERT_EQ(std::errc {}, result.ec);
+    EXPECT_EQ(buffer.data() + 15, result.ptr);
+    EXPECT_EQ("255.255.255.255", std::string(buffer.data(), result.ptr));
+
+    // Nothing past last is written
+    EXPECT_EQ('x', buffer[15]);
+}
+
+TEST(ipv4_to_chars, too_small)
+{
+    const ndgpp::net::ipv4_array value {{10, 0, 0, 1}};
+    std::array<char, 8> buffer;
+    buffer.fill('x');
+
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + 7, value);
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+    EXPECT_EQ(buffer.data() + 7, result.ptr);
+    EXPECT_EQ('x', buffer[7]);
+}
+
+TEST(ipv4_to_chars, address)
+{
+    const ndgpp::net::ipv4_address addr {std::array<uint8_t, 4> {{192, 168, 10, 1}}};
+    std::array<char, 16> buffer;
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), addr);
+    ASSERT_EQ(std::errc {}, result.ec);
+    EXPECT_EQ("192.168.10.1", std::string(buffer.data(), result.ptr));
+    EXPECT_EQ("192.168.10.1", addr.to_string());
+}
+
+TEST(ipv4_to_chars, bulk)
+{
+    std::mt19937 gen {3};
+    std::vector<ndgpp::net::ipv4_address> addrs;
+    std::string expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        addrs.emplace_back(static_cast<uint32_t>(gen()));
+        expected += reference_string(addrs.back().value()) + '\n';
+    }
+
+    std::vector<char> buffer(expected.size());
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + buffer.size(), addrs.data(), addrs.size());
+    ASSERT_EQ(std::errc {}, result.ec);
+    EXPECT_EQ(buffer.data() + buffer.size(), result.ptr);
+    EXPECT_EQ(expected, std::string(buffer.data(), result.ptr));
+}
+
+TEST(ipv4_to_chars, bulk_too_small)
+{
+    const std::array<ndgpp::net::ipv4_array, 3> values {{{{1, 1, 1, 1}}, {{2, 2, 2, 2}}, {{3, 3, 3, 3}}}};
+    std::array<char, 24> buffer;
+
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer.data(), buffer.data() + 23, values.data(), values.size(), ' ');
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+    EXPECT_EQ(buffer.data() + 23, result.ptr);
+    EXPECT_EQ("1.1.1.1 2.2.2.2 ", std::string(buffer.data(), buffer.data() + 16));
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv6_lpm_table.hpp>
+
+namespace
+{
+    ndgpp::net::ipv6_address addr(const std::string & value)
+    {
+        return ndgpp::net::ipv6_address {value};
+    }
+
+    ndgpp::net::ipv6_prefix_length length(const unsigned int value)
+    {
+        return ndgpp::net::ipv6_prefix_length {value};
+    }
+
+    /// Returns true if the first length bits of lhs and rhs are the same
+    bool prefix_equal(const ndgpp::net::ipv6_address lhs, const ndgpp::net::ipv6_address rhs, const unsigned int length)
+    {
+        for (unsigned int bit = 0; bit < length; ++bit)
+        {
+            const unsigned int shift = 7 - bit % 8;
+            if ((lhs[bit / 8] >> shift & 1) != (rhs[bit / 8] >> shift & 1))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    using prefix_key = std::tuple<uint64_t, uint64_t, unsigned int>;
+
+    prefix_key make_key(const ndgpp::net::ipv6_address prefix, const unsigned int length)
+    {
+        // Clear the bits after the prefix so equal prefixes have equal keys
+        uint64_t high = prefix.high();
+        uint64_t low = prefix.low();
+        if (length <= 64)
+        {
+            high = length == 0 ? 0 : high & ~uint64_t {0} << (64 - length);
+            low = 0;
+        }
+        else
+        {
+            low &= ~uint64_t {0} << (128 - length);
+        }
+
+        return prefix_key {high, low, length};
+    }
+
+    /// Finds the longest matching prefix by checking every prefix
+    uint32_t reference_lookup(const std::map<prefix_key, uint32_t> & prefixes, const ndgpp::net::ipv6_address address)
+    {
+        int best_length = -1;
+        uint32_t best = ndgpp::net::ipv6_lpm_table::no_match;
+        for (const auto & prefix: prefixes)
+        {
+            const ndgpp::net::ipv6_address network {std::get<0>(prefix.first), std::get<1>(prefix.first)};
+            const int prefix_length = static_cast<int>(std::get<2>(prefix.first));
+            if (prefix_length > best_length && prefix_equal(network, address, static_cast<unsigned int>(prefix_length)))
+            {
+                best_length = prefix_length;
+                best = prefix.second;
+            }
+        }
+
+        return best;
+    }
+}
+
+TEST(ipv6_lpm_table, empty)
+{
+    const ndgpp::net::ipv6_lpm_table table;
+    EXPECT_EQ(0U, table.size());
+    EXPECT_EQ(ndgpp::net::ipv6_lpm_table::no_match, table.lookup(addr("2001:db8::1")));
+}
+
+TEST(ipv6_lpm_table, longest_match)
+{
+    ndgpp::net::ipv6_lpm_table table;
+    table.insert(addr("::"), length(0), 0);
+    table.insert(addr("2001:db8::"), length(32), 1);
+    table.insert(addr("2001:db8:1::"), length(48), 2);
+    table.insert(addr("2001:db8:1:2::"), length(64), 3);
+    table.insert(addr("2001:db8:1:2:8000::"), length(65), 4);
+    table.insert(addr("2001:db8:1:2::1"), length(128), 5);
+
+    EXPECT_EQ(6U, table.size());
+    EXPECT_EQ(0U, table.lookup(addr("fe80::1")));
+    EXPECT_EQ(1U, table.lookup(addr("2001:db8:ffff::1")));
+    EXPECT_EQ(2U, table.lookup(addr("2001:db8:1:3::1")));
+    EXPECT_EQ(3U, table.lookup(addr("2001:db8:1:2::2")));
+    EXPECT_EQ(4U, table.lookup(addr("2001:db8:1:2:8000::2")));
+    EXPECT_EQ(5U, table.lookup(addr("2001:db8:1:2::1")));
+}
+
+TEST(ipv6_lpm_table, host_bits_ignored)
+{
+    ndgpp::net::ipv6_lpm_table table;
+    table.insert(addr("2001:db8::ffff"), length(32), 1);
+    EXPECT_EQ(1U, table.lookup(addr("2001:db8:aaaa::")));
+
+    table.insert(addr("2001:db8::"), length(32), 2);
+    EXPECT_EQ(1U, table.size());
+    EXPECT_EQ(2U, table.lookup(addr("2001:db8:aaaa::")));
+}
+
+TEST(ipv6_lpm_table, erase)
+{
+    ndgpp::net::ipv6_lpm_table table;
+    table.insert(addr("2001:db8::"), length(32), 1);
+    table.insert(addr("2001:db8:1:2::"), length(64), 3);
+    table.insert(addr("2001:db8:1:2::1"), length(128), 5);
+
+    EXPECT_TRUE(table.erase(addr("2001:db8:1:2::"), length(64)));
+    EXPECT_FALSE(table.erase(addr("2001:db8:1:2::"), length(64)));
+    EXPECT_FALSE(table.erase(addr("2001:db8:1:2::"), length(63)));
+    EXPECT_FALSE(table.erase(addr("3001::"), length(96)));
+    EXPECT_EQ(1U, table.lookup(addr("2001:db8:1:2::2")));
+    EXPECT_EQ(5U, table.lookup(addr("2001:db8:1:2::1")));
+
+    EXPECT_TRUE(table.erase(addr("2001:db8:1:2::1"), length(128)));
+    EXPECT_EQ(1U, table.lookup(addr("2001:db8:1:2::1")));
+
+    EXPECT_TRUE(table.erase(addr("2001:db8::"), length(32)));
+    EXPECT_EQ(ndgpp::net::ipv6_lpm_table::no_match, table.lookup(addr("2001:db8:1:2::1")));
+    EXPECT_EQ(0U, table.size());
+}
+
+TEST(ipv6_lpm_table, value_out_of_range)
+{
+    ndgpp::net::ipv6_lpm_table table;
+    EXPECT_THROW(table.insert(addr("2001:db8::"), length(32), ndgpp::net::ipv6_lpm_table::no_match),
+                 ndgpp::error<std::out_of_range>);
+}
+
+TEST(ipv6_lpm_table, matches_reference)
+{
+    std::mt19937_64 gen {17};
+
+    // Prefixes share their first 16 bits and have few distinct bits
+    // after that, so they nest and share nodes
+    auto random_address = [&gen] () {
+        const uint64_t bits = gen();
+        return ndgpp::net::ipv6_address {0x2001000000000000 | (bits & 0x0000f0f000000000),
+                                         (bits & 0x3) << 62 | (bits >> 8 & 0x3)};
+    };
+
+    ndgpp::net::ipv6_lpm_table table;
+    std::map<prefix_key, uint32_t> prefixes;
+    std::vector<ndgpp::net::ipv6_address> addresses;
+    for (int i = 0; i < 1000; ++i)
+    {
+        addresses.push_back(random_address());
+    }
+
+    const unsigned int lengths[] = {0, 16, 20, 24, 28, 30, 32, 36, 48, 60, 62, 63, 64, 65, 66, 67, 96, 126, 127, 128};
+    for (int round = 0; round < 600; ++round)
+    {
+        const unsigned int prefix_length = lengths[gen() % (sizeof(lengths) / sizeof(lengths[0]))];
+        const ndgpp::net::ipv6_address prefix = random_address();
+
+        if (round % 3 == 2 && !prefixes.empty())
+        {
+            auto iter = prefixes.begin();
+            std::advance(iter, gen() % prefixes.size());
+            const ndgpp::net::ipv6_address erased {std::get<0>(iter->first), std::get<1>(iter->first)};
+            EXPECT_TRUE(table.erase(erased, length(std::get<2>(iter->first))));
+            prefixes.erase(iter);
+        }
+        else
+        {
+            const uint32_t value = static_cast<uint32_t>(gen() % 1000);
+            table.insert(prefix, length(prefix_length), value);
+            prefixes[make_key(prefix, prefix_length)] = value;
+        }
+
+        ASSERT_EQ(prefixes.size(), table.size());
+    }
+
+    std::vector<uint32_t> values(addresses.size());
+    table.lookup(addresses.data(), addresses.size(), values.data());
+    for (std::size_t i = 0; i < addresses.size(); ++i)
+    {
+        ASSERT_EQ(reference_lookup(prefixes, addresses[i]), values[i]);
+        ASSERT_EQ(values[i], table.lookup(addresses[i]));
+    }
+
+    while (!prefixes.empty())
+    {
+        const auto & key = prefixes.begin()->first;
+        EXPECT_TRUE(table.erase(ndgpp::net::ipv6_address {std::get<0>(key), std::get<1>(key)}, length(std::get<2>(key))));
+        prefixes.erase(prefixes.begin());
+    }
+
+    for (const ndgpp::net::ipv6_address & address: addresses)
+    {
+        ASSERT_EQ(ndgpp::net::ipv6_lpm_table::no_match, table.lookup(address));
+    }
+
+    table.insert(addr("2001::"), length(16), 9);
+    EXPECT_EQ(9U, table.lookup(addresses[0]));
+    table.clear();
+    EXPECT_EQ(0U, table.size());
+    EXPECT_EQ(ndgpp::net::ipv6_lpm_table::no_match, table.lookup(addresses[0]));
+}
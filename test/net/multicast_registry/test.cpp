@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/multicast_registry.hpp>
+
+namespace
+{
+    ndgpp::net::multicast_ipv4_address group(const std::string & value)
+    {
+        return ndgpp::net::multicast_ipv4_address {value};
+    }
+
+    ndgpp::net::ipv4_address source(const std::string & value)
+    {
+        return ndgpp::net::ipv4_address {value};
+    }
+
+    constexpr uint32_t no_subscriber = ndgpp::net::multicast_registry::no_subscriber;
+}
+
+TEST(multicast_registry, any_source)
+{
+    ndgpp::net::multicast_registry registry {16};
+    EXPECT_EQ(0U, registry.size());
+    EXPECT_EQ(16U, registry.max_size());
+    EXPECT_EQ(no_subscriber, registry.lookup(group("239.1.1.1")));
+
+    registry.insert(group("239.1.1.1"), 1);
+    registry.insert(group("239.1.1.2"), 2);
+    EXPECT_EQ(2U, registry.size());
+    EXPECT_EQ(1U, registry.lookup(group("239.1.1.1")));
+    EXPECT_EQ(2U, registry.lookup(group("239.1.1.2")));
+    EXPECT_EQ(2U, registry.lookup(source("10.0.0.1"), group("239.1.1.2")));
+
+    registry.insert(group("239.1.1.1"), 5);
+    EXPECT_EQ(2U, registry.size());
+    EXPECT_EQ(5U, registry.lookup(group("239.1.1.1")));
+}
+
+TEST(multicast_registry, source_specific)
+{
+    ndgpp::net::multicast_registry registry {16};
+    registry.insert(source("10.0.0.1"), group("232.1.1.1"), 1);
+    EXPECT_EQ(1U, registry.lookup(source("10.0.0.1"), group("232.1.1.1")));
+    EXPECT_EQ(no_subscriber, registry.lookup(source("10.0.0.2"), group("232.1.1.1")));
+    EXPECT_EQ(no_subscriber, registry.lookup(group("232.1.1.1")));
+
+    registry.insert(group("232.1.1.1"), 2);
+    EXPECT_EQ(1U, registry.lookup(source("10.0.0.1"), group("232.1.1.1")));
+    EXPECT_EQ(2U, registry.lookup(source("10.0.0.2"), group("232.1.1.1")));
+
+    EXPECT_TRUE(registry.erase(source("10.0.0.1"), group("232.1.1.1")));
+    EXPECT_FALSE(registry.erase(source("10.0.0.1"), group("232.1.1.1")));
+    EXPECT_EQ(2U, registry.lookup(source("10.0.0.1"), group("232.1.1.1")));
+    EXPECT_EQ(1U, registry.size());
+}
+
+TEST(multicast_registry, erase_and_reuse)
+{
+    ndgpp::net::multicast_registry registry {100};
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        registry.insert(ndgpp::net::multicast_ipv4_address {0xe0000100 + i}, i);
+    }
+
+    EXPECT_THROW(registry.insert(group("239.0.0.1"), 1), ndgpp::error<std::length_error>);
+
+    for (uint32_t i = 0; i < 100; i += 2)
+    {
+        EXPECT_TRUE(registry.erase(ndgpp::net::multicast_ipv4_address {0xe0000100 + i}));
+    }
+
+    EXPECT_EQ(50U, registry.size());
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(i % 2 ? i : no_subscriber, registry.lookup(ndgpp::net::multicast_ipv4_address {0xe0000100 + i}));
+    }
+
+    // Churn through many more keys than the table has slots
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        registry.insert(ndgpp::net::multicast_ipv4_address {0xe1000000 + i}, i);
+        EXPECT_TRUE(registry.erase(ndgpp::net::multicast_ipv4_address {0xe1000000 + i}));
+    }
+
+    EXPECT_EQ(50U, registry.size());
+    EXPECT_EQ(99U, registry.lookup(ndgpp::net::multicast_ipv4_address {0xe0000100 + 99}));
+
+    registry.clear();
+    EXPECT_EQ(0U, registry.size());
+    EXPECT_EQ(no_subscriber, registry.lookup(ndgpp::net::multicast_ipv4_address {0xe0000100 + 99}));
+}
+
+TEST(multicast_registry, invalid_arguments)
+{
+    EXPECT_THROW(ndgpp::net::multicast_registry {0}, ndgpp::error<std::invalid_argument>);
+
+    ndgpp::net::multicast_registry registry {4};
+    EXPECT_THROW(registry.insert(group("239.1.1.1"), no_subscriber), ndgpp::error<std::invalid_argument>);
+}
+
+TEST(multicast_registry, zero_source)
+{
+    ndgpp::net::multicast_registry registry {4};
+    registry.insert(group("239.1.1.1"), 1);
+
+    // A source of zero would share the (*, G) key
+    EXPECT_THROW(registry.insert(source("0.0.0.0"), group("239.1.1.1"), 2), ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(registry.erase(source("0.0.0.0"), group("239.1.1.1")), ndgpp::error<std::invalid_argument>);
+
+    EXPECT_EQ(1U, registry.size());
+    EXPECT_EQ(1U, registry.lookup(group("239.1.1.1")));
+    EXPECT_EQ(1U, registry.lookup(source("0.0.0.0"), group("239.1.1.1")));
+}
+
+TEST(multicast_registry, batch_lookup)
+{
+    ndgpp::net::multicast_registry registry {64};
+    registry.insert(group("239.1.1.1"), 1);
+    registry.insert(source("10.0.0.1"), group("239.1.1.2"), 2);
+
+    std::vector<ndgpp::net::multicast_ipv4_address> groups;
+    std::vector<ndgpp::net::ipv4_address> sources;
+    for (int i = 0; i < 40; ++i)
+    {
+        groups.push_back(group(i % 3 == 0 ? "239.1.1.1" : i % 3 == 1 ? "239.1.1.2" : "239.1.1.3"));
+        sources.push_back(source(i % 2 ? "10.0.0.1" : "10.0.0.2"));
+    }
+
+    std::vector<uint32_t> handles(groups.size());
+    registry.lookup(groups.data(), groups.size(), handles.data());
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        EXPECT_EQ(registry.lookup(groups[i]), handles[i]);
+    }
+
+    registry.lookup(sources.data(), groups.data(), groups.size(), handles.data());
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        EXPECT_EQ(registry.lookup(sources[i], groups[i]), handles[i]);
+    }
+}
+
+TEST(multicast_registry, concurrent_writer)
+{
+    ndgpp::net::multicast_registry registry {256};
+
+    // These groups are never modified, so every lookup must find them
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        registry.insert(ndgpp::net::multicast_ipv4_address {0xe0000000 + i}, i);
+    }
+
+    // The writer uses different groups each round, so erased slots
+    // accumulate and the table is rebuilt while lookups run
+    std::atomic<bool> done {false};
+    std::thread writer {[&registry, &done] () {
+        for (uint32_t round = 0; round < 2000; ++round)
+        {
+            for (uint32_t i = 0; i < 64; ++i)
+            {
+                registry.insert(ndgpp::net::multicast_ipv4_address {0xe1000000 + round * 64 + i}, round);
+            }
+
+            for (uint32_t i = 0; i < 64; ++i)
+            {
+                registry.erase(ndgpp::net::multicast_ipv4_address {0xe1000000 + round * 64 + i});
+            }
+        }
+
+        done = true;
+    }};
+
+    std::size_t failures = 0;
+    while (!done)
+    {
+        for (uint32_t i = 0; i < 64; ++i)
+        {
+            failures += registry.lookup(ndgpp::net::multicast_ipv4_address {0xe0000000 + i}) != i;
+
+            const uint32_t handle = registry.lookup(ndgpp::net::multicast_ipv4_address {0xe1000000 + i});
+            failures += handle != no_subscriber && handle >= 2000;
+        }
+    }
+
+    writer.join();
+    EXPECT_EQ(0U, failures);
+}
+
+TEST(multicast_registry, churn)
+{
+    ndgpp::net::multicast_registry registry {1000};
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        registry.insert(ndgpp::net::multicast_ipv4_address {0xe0000000 + i}, i);
+    }
+
+    std::size_t max_used_slots = 0;
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        const ndgpp::net::multicast_ipv4_address churned {0xe1000000 + i};
+        registry.insert(churned, i);
+        ASSERT_EQ(i, registry.lookup(churned));
+        ASSERT_TRUE(registry.erase(churned));
+        max_used_slots = std::max(max_used_slots, registry.used_slots());
+    }
+
+    // Erased slots never take over the empty slots that end probes
+    EXPECT_LE(max_used_slots, registry.capacity() / 4 * 3);
+    EXPECT_EQ(500U, registry.size());
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        EXPECT_EQ(i, registry.lookup(ndgpp::net::multicast_ipv4_address {0xe0000000 + i}));
+    }
+
+    EXPECT_EQ(no_subscriber, registry.lookup(ndgpp::net::multicast_ipv4_address {0xe2000000}));
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv4_array.hpp>
+
+namespace
+{
+    ndgpp::net::ipv4_parse_result parse(const std::string & str)
+    {
+        return ndgpp::net::parse_ipv4_array(str.data(), str.data() + str.size());
+    }
+
+    /// Parses an address the slow way, the parser must agree with it
+    bool reference_parse(const std::string & str, ndgpp::net::ipv4_array & octets, std::size_t & end)
+    {
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            if (i != 0)
+            {
+                if (pos == str.size() || str[pos] != '.')
+                {
+                    return false;
+                }
+
+                ++pos;
+            }
+
+            std::size_t digits = 0;
+            unsigned int value = 0;
+            while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9')
+            {
+                value = value * 10 + static_cast<unsigned int>(str[pos] - '0');
+                ++digits;
+                ++pos;
+                if (digits > 3)
+                {
+                    return false;
+                }
+            }
+
+            if (digits == 0 || value > 255)
+            {
+                return false;
+            }
+
+            octets[i] = static_cast<uint8_t>(value);
+        }
+
+        end = pos;
+        return true;
+    }
+}
+
+TEST(parse_ipv4_array, valid)
+{
+    const std::string str = "192.168.1.254";
+    const auto result = parse(str);
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ((ndgpp::net::ipv4_array {{192, 168, 1, 254}}), result.value());
+    EXPECT_EQ(str.data() + str.size(), result.unparsed());
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::none, result.error());
+}
+
+TEST(parse_ipv4_array, extremes)
+{
+    EXPECT_EQ((ndgpp::net::ipv4_array {{0, 0, 0, 0}}), parse("0.0.0.0").value());
+    EXPECT_EQ((ndgpp::net::ipv4_array {{255, 255, 255, 255}}), parse("255.255.255.255").value());
+    EXPECT_EQ((ndgpp::net::ipv4_array {{1, 2, 3, 4}}), parse("001.002.003.004").value());
+}
+
+TEST(parse_ipv4_array, trailing_text)
+{
+    const std::string str = "10.0.0.1:8080 and more text after the address";
+    const auto result = parse(str);
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ((ndgpp::net::ipv4_array {{10, 0, 0, 1}}), result.value());
+    EXPECT_EQ(':', *result.unparsed());
+
+    const std::string dotted = "1.2.3.4.5";
+    const auto dotted_result = parse(dotted);
+    ASSERT_TRUE(static_cast<bool>(dotted_result));
+    EXPECT_EQ(dotted.data() + 7, dotted_result.unparsed());
+}
+
+TEST(parse_ipv4_array, errors)
+{
+    const std::string empty;
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::expected_digit, parse(empty).error());
+
+    const std::string missing = "1.2.3";
+    const auto missing_result = parse(missing);
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::expected_dot, missing_result.error());
+    EXPECT_EQ(missing.data() + 5, missing_result.unparsed());
+
+    const std::string double_dot = "1..2.3";
+    const auto double_dot_result = parse(double_dot);
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::expected_digit, double_dot_result.error());
+    EXPECT_EQ(double_dot.data() + 2, double_dot_result.unparsed());
+
+    const std::string too_long = "1.2.3333.4";
+    const auto too_long_result = parse(too_long);
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::octet_too_long, too_long_result.error());
+    EXPECT_EQ(too_long.data() + 4, too_long_result.unparsed());
+
+    const std::string out_of_range = "1.2.3.256";
+    const auto out_of_range_result = parse(out_of_range);
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::octet_out_of_range, out_of_range_result.error());
+    EXPECT_EQ(out_of_range.data() + 6, out_of_range_result.unparsed());
+
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::expected_digit, parse("a.2.3.4").error());
+    EXPECT_EQ(ndgpp::net::ipv4_parse_errc::expected_dot, parse("1 2.3.4").error());
+    EXPECT_THROW(parse("1.2").value(), ndgpp::error<std::logic_error>);
+}
+
+TEST(parse_ipv4_array, does_not_read_past_last)
+{
+    // Only the first seven characters are part of the input
+    const std::string str = "1.2.3.45678";
+    const auto result = ndgpp::net::parse_ipv4_array(str.data(), str.data() + 7);
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ((ndgpp::net::ipv4_array {{1, 2, 3, 4}}), result.value());
+    EXPECT_EQ(str.data() + 7, result.unparsed());
+}
+
+TEST(parse_ipv4_array, matches_reference)
+{
+    std::mt19937 gen {7};
+    const std::string alphabet = "0123456789012345678901234567890123456789....:x ";
+    std::uniform_int_distribution<std::size_t> char_dist {0, alphabet.size() - 1};
+    std::uniform_int_distribution<std::size_t> size_dist {0, 24};
+    std::uniform_int_distribution<unsigned int> octet_dist {0, 300};
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        std::string str;
+        if (i % 2)
+        {
+            str = std::to_string(octet_dist(gen)) + '.' + std::to_string(octet_dist(gen)) + '.' +
+                  std::to_string(octet_dist(gen)) + '.' + std::to_string(octet_dist(gen));
+        }
+
+        const std::size_t size = size_dist(gen);
+        for (std::size_t j = 0; j < size; ++j)
+        {
+            str.push_back(alphabet[char_dist(gen)]);
+        }
+
+        ndgpp::net::ipv4_array expected;
+        std::size_t end = 0;
+        const bool valid = reference_parse(str, expected, end);
+
+        const auto result = parse(str);
+        ASSERT_EQ(valid, static_cast<bool>(result)) << str;
+        if (valid)
+        {
+            EXPECT_EQ(expected, result.value()) << str;
+            EXPECT_EQ(str.data() + end, result.unparsed()) << str;
+        }
+    }
+}
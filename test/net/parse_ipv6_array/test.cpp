@@ -0,0 +1,163 @@
+#include <arpa/inet.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <libndgpp/error.hpp>
+#include <libndgpp/net/ipv6_array.hpp>
+
+namespace
+{
+    ndgpp::net::ipv6_parse_result parse(const std::string & value)
+    {
+        return ndgpp::net::parse_ipv6_array(value.data(), value.data() + value.size());
+    }
+
+    ndgpp::net::ipv6_array pton(const std::string & value)
+    {
+        ndgpp::net::ipv6_array array;
+        EXPECT_EQ(1, inet_pton(AF_INET6, value.c_str(), array.data()));
+        return array;
+    }
+
+    std::string ntop(const ndgpp::net::ipv6_array value)
+    {
+        char buffer[INET6_ADDRSTRLEN];
+        return inet_ntop(AF_INET6, value.data(), buffer, sizeof(buffer));
+    }
+}
+
+TEST(parse_ipv6_array, valid)
+{
+    const char * const addresses[] = {
+        "::",
+        "::1",
+        "1::",
+        "2001:db8::1",
+        "2001:DB8:0:0:8:800:200C:417A",
+        "ff01::101",
+        "1:2:3:4:5:6:7:8",
+        "1:2:3:4:5:6:7::",
+        "::2:3:4:5:6:7:8",
+        "1:0:0:2::3",
+        "::ffff:192.0.2.1",
+        "::13.1.68.3",
+        "64:ff9b::192.0.2.33",
+        "1:2:3:4:5:6:1.2.3.4",
+        "1::5:6:1.2.3.4",
+        "fe80::abcd:ef01",
+    };
+
+    for (const char * const address: addresses)
+    {
+        const ndgpp::net::ipv6_parse_result result = ndgpp::net::parse_ipv6_array(address, address + std::strlen(address));
+        ASSERT_TRUE(static_cast<bool>(result)) << address;
+        EXPECT_EQ(pton(address), result.value()) << address;
+        EXPECT_EQ(address + std::strlen(address), result.unparsed()) << address;
+    }
+}
+
+TEST(parse_ipv6_array, unparsed)
+{
+    const std::string value {"2001:db8::1 next"};
+    const ndgpp::net::ipv6_parse_result result = parse(value);
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(value.data() + 11, result.unparsed());
+
+    // A :: that is not followed by a group ends the address
+    const std::string trailing {"1::]"};
+    const ndgpp::net::ipv6_parse_result trailing_result = parse(trailing);
+    ASSERT_TRUE(static_cast<bool>(trailing_result));
+    EXPECT_EQ(trailing.data() + 3, trailing_result.unparsed());
+}
+
+TEST(parse_ipv6_array, errors)
+{
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::expected_digit, parse("").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::expected_digit, parse(":1::").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::expected_digit, parse("1:2:").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::expected_digit, parse("1:2:3:4:5:6:7:8:").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::group_too_long, parse("12345::").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_many_groups, parse("1:2:3:4:5:6:7:8:9").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_many_groups, parse("1:2:3:4::5:6:7:8").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_many_groups, parse("1:2:3:4:5:6:7:1.2.3.4").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_many_groups, parse("1:2:3:4:5:6:7:8::").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_many_groups, parse("1:2:3:4:5:6:7:8::9").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_many_groups, parse("::1:2:3:4:5:6:7:8").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_few_groups, parse("1:2:3:4:5:6:7").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::too_few_groups, parse("1:2:3:4:5:1.2.3.4").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::multiple_compressions, parse("1::2::3").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::invalid_ipv4, parse("::1.2.3.256").error());
+    EXPECT_EQ(ndgpp::net::ipv6_parse_errc::invalid_ipv4, parse("::1.2.3").error());
+
+    EXPECT_THROW(parse("1::2::3").value(), ndgpp::error<std::logic_error>);
+    EXPECT_THROW(ndgpp::net::make_ipv6_array("1::2 "), ndgpp::error<std::invalid_argument>);
+    EXPECT_THROW(ndgpp::net::make_ipv6_array("1:2:3:4:5:6:7:8::"), ndgpp::error<std::invalid_argument>);
+}
+
+TEST(ipv6_to_chars, canonical)
+{
+    const std::pair<const char *, const char *> addresses[] = {
+        {"::", "::"},
+        {"::1", "::1"},
+        {"1::", "1::"},
+        {"2001:DB8:0:0:0:0:2:1", "2001:db8::2:1"},
+        {"2001:db8:0:1:1:1:1:1", "2001:db8:0:1:1:1:1:1"},
+        {"2001:0:0:1:0:0:0:1", "2001:0:0:1::1"},
+        {"2001:db8:0:0:1:0:0:1", "2001:db8::1:0:0:1"},
+        {"2001:0db8:0000:0000:0000:ff00:0042:8329", "2001:db8::ff00:42:8329"},
+        {"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"},
+        {"::ffff:c000:0201", "::ffff:192.0.2.1"},
+        {"::ffff:0:0", "::ffff:0.0.0.0"},
+    };
+
+    for (const auto & address: addresses)
+    {
+        EXPECT_EQ(address.second, ndgpp::net::to_string(ndgpp::net::make_ipv6_array(address.first)));
+    }
+}
+
+TEST(ipv6_to_chars, buffer_too_small)
+{
+    const ndgpp::net::ipv6_array value = ndgpp::net::make_ipv6_array("2001:db8::1");
+
+    char buffer[11];
+    const ndgpp::to_chars_result result = ndgpp::net::to_chars(buffer, buffer + 10, value);
+    EXPECT_EQ(buffer + 10, result.ptr);
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+
+    const ndgpp::to_chars_result exact = ndgpp::net::to_chars(buffer, buffer + 11, value);
+    EXPECT_EQ(std::errc {}, exact.ec);
+    EXPECT_EQ("2001:db8::1", std::string(buffer, exact.ptr));
+}
+
+TEST(ipv6_to_chars, round_trip)
+{
+    std::mt19937 gen {13};
+    for (int i = 0; i < 10000; ++i)
+    {
+        // Zero groups are common so the compression is exercised
+        ndgpp::net::ipv6_array value {};
+        for (std::size_t group = 0; group < 8; ++group)
+        {
+            if (gen() % 2)
+            {
+                const uint32_t bits = static_cast<uint32_t>(gen());
+                value[2 * group] = static_cast<uint8_t>(bits >> (bits % 3 * 4));
+                value[2 * group + 1] = static_cast<uint8_t>(bits >> 8);
+            }
+        }
+
+        const std::string text = ndgpp::net::to_string(value);
+        ASSERT_EQ(value, ndgpp::net::make_ipv6_array(text)) << text;
+
+        // inet_ntop also writes the deprecated IPv4-compatible form, ::a.b.c.d
+        if (ndgpp::net::ipv6_high(value) != 0 || ndgpp::net::ipv6_low(value) >> 32 != 0)
+        {
+            ASSERT_EQ(ntop(value), text);
+        }
+    }
+}
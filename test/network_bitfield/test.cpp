@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <libndgpp/network_bitfield.hpp>
+
+namespace
+{
+    using version = ndgpp::network_bitfield<uint8_t, 0, 4>;
+    using ihl = ndgpp::network_bitfield<uint8_t, 4, 4>;
+    using dscp = ndgpp::network_bitfield<uint8_t, 0, 6>;
+    using ecn = ndgpp::network_bitfield<uint8_t, 6, 2>;
+    using flags = ndgpp::network_bitfield<uint16_t, 0, 3>;
+    using fragment_offset = ndgpp::network_bitfield<uint16_t, 3, 13>;
+}
+
+TEST(network_bitfield, constants)
+{
+    EXPECT_EQ(0xf0, version::mask);
+    EXPECT_EQ(4U, version::shift);
+    EXPECT_EQ(0x0f, ihl::mask);
+    EXPECT_EQ(0U, ihl::shift);
+    EXPECT_EQ(0xe000, flags::mask);
+    EXPECT_EQ(0x1fff, fragment_offset::mask);
+    EXPECT_EQ(0xffffffffffffffff, (ndgpp::network_bitfield<uint64_t, 0, 64>::mask));
+}
+
+TEST(network_bitfield, host_word)
+{
+    constexpr uint16_t word = 0x5abc;
+    constexpr uint16_t flags_value = flags::get(word);
+    constexpr uint16_t offset_value = fragment_offset::get(word);
+
+    EXPECT_EQ(0x2, flags_value);
+    EXPECT_EQ(0x1abc, offset_value);
+    EXPECT_EQ(0xbabc, flags::set(word, 0x5));
+    EXPECT_EQ(0x4001, fragment_offset::set(word, 0x2001));
+
+    // A literal zero is a word, not a null buffer
+    EXPECT_EQ(0, flags::get(0));
+    EXPECT_EQ(0x4000, flags::set(0, 0x2));
+}
+
+TEST(network_bitfield, buffer)
+{
+    // version 4, ihl 5, dscp 46, ecn 1, flags 2, fragment offset 0x123
+    std::array<uint8_t, 8> header = {0x45, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x41, 0x23};
+
+    EXPECT_EQ(4, version::load(header.data()));
+    EXPECT_EQ(5, ihl::load(header.data()));
+    EXPECT_EQ(46, dscp::load(header.data() + 1));
+    EXPECT_EQ(1, ecn::load(header.data() + 1));
+    EXPECT_EQ(2, flags::load(header.data() + 6));
+    EXPECT_EQ(0x123, fragment_offset::load(header.data() + 6));
+
+    ihl::store(header.data(), 6);
+    ecn::store(header.data() + 1, 3);
+    fragment_offset::store(header.data() + 6, 0x1fff);
+    flags::store(header.data() + 6, 0);
+
+    EXPECT_EQ(0x46, header[0]);
+    EXPECT_EQ(0xbb, header[1]);
+    EXPECT_EQ(0x1f, header[6]);
+    EXPECT_EQ(0xff, header[7]);
+}
+
+TEST(network_bitfield, network_byte_order)
+{
+    ndgpp::network_byte_order<uint16_t> word {0x4123};
+    EXPECT_EQ(0x2, flags::get(word));
+    EXPECT_EQ(0x123, fragment_offset::get(word));
+
+    flags::set(word, 0x1);
+    EXPECT_EQ(0x2123, static_cast<uint16_t>(word));
+
+    ndgpp::unaligned_network_byte_order<uint16_t> unaligned_word {0x4123};
+    EXPECT_EQ(0x123, fragment_offset::get(unaligned_word));
+
+    fragment_offset::set(unaligned_word, 0x321);
+    EXPECT_EQ(0x4321, static_cast<uint16_t>(unaligned_word));
+}
+
+TEST(network_bitfield, truncation)
+{
+    std::array<uint8_t, 1> byte = {0x00};
+    version::store(byte.data(), 0xff);
+    EXPECT_EQ(0xf0, byte[0]);
+}
@@ -174,3 +174,15 @@ TYPED_TEST(operator_test, insertion)
 
     EXPECT_EQ(val.value(), this->nb1);
 }
+
+TYPED_TEST(operator_test, host_value_ordering)
+{
+    using value_type = typename TestFixture::value_type;
+
+    // The least significant byte of the larger value is smaller
+    const ndgpp::network_byte_order<value_type> small {static_cast<value_type>(0x00ff)};
+    const ndgpp::network_byte_order<value_type> large {static_cast<value_type>(0x0100)};
+
+    EXPECT_LT(small, large);
+    EXPECT_GT(large, small);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <libndgpp/serial_number.hpp>
+
+TEST(serial_number, rfc1982_examples)
+{
+    using serial = ndgpp::serial_number<uint8_t>;
+
+    EXPECT_LT(serial {0}, serial {1});
+    EXPECT_LT(serial {0}, serial {44});
+    EXPECT_LT(serial {0}, serial {100});
+    EXPECT_LT(serial {44}, serial {100});
+    EXPECT_LT(serial {100}, serial {200});
+    EXPECT_LT(serial {200}, serial {255});
+    EXPECT_LT(serial {255}, serial {0});
+    EXPECT_LT(serial {255}, serial {100});
+    EXPECT_LT(serial {200}, serial {0});
+    EXPECT_LT(serial {200}, serial {44});
+
+    EXPECT_FALSE(serial {1} < serial {0});
+    EXPECT_FALSE(serial {0} < serial {255});
+    EXPECT_FALSE(serial {5} < serial {5});
+}
+
+TEST(serial_number, addition_wraps)
+{
+    ndgpp::serial_number<uint16_t> value {65535};
+    ++value;
+    EXPECT_EQ(0, value.value());
+
+    value += 32767;
+    EXPECT_EQ(32767, value.value());
+    EXPECT_GT(value, ndgpp::serial_number<uint16_t> {0});
+
+    const auto next = value + uint16_t {2};
+    EXPECT_EQ(32769, next.value());
+    EXPECT_LT(value, next);
+}
+
+TEST(serial_number, comparison)
+{
+    using serial = ndgpp::serial_number<uint32_t>;
+
+    EXPECT_EQ(serial {7}, serial {7});
+    EXPECT_NE(serial {7}, serial {8});
+    EXPECT_LE(serial {7}, serial {7});
+    EXPECT_LE(serial {0xffffffff}, serial {3});
+    EXPECT_GE(serial {3}, serial {0xffffffff});
+    EXPECT_GT(serial {3}, serial {0xffffffff});
+}
+
+TEST(serial_number, distance)
+{
+    using serial = ndgpp::serial_number<uint16_t>;
+
+    EXPECT_EQ(3, ndgpp::distance(serial {65534}, serial {1}));
+    EXPECT_EQ(-3, ndgpp::distance(serial {1}, serial {65534}));
+    EXPECT_EQ(0, ndgpp::distance(serial {9}, serial {9}));
+}
+
+TEST(serial_number, in_window)
+{
+    using serial = ndgpp::serial_number<uint32_t>;
+
+    EXPECT_TRUE(ndgpp::in_window(serial {0xfffffffe}, serial {0xfffffffe}, 4U));
+    EXPECT_TRUE(ndgpp::in_window(serial {1}, serial {0xfffffffe}, 4U));
+    EXPECT_FALSE(ndgpp::in_window(serial {2}, serial {0xfffffffe}, 4U));
+    EXPECT_FALSE(ndgpp::in_window(serial {0xfffffffd}, serial {0xfffffffe}, 4U));
+}
+
+TEST(serial_number, int_literal_operands)
+{
+    using serial = ndgpp::serial_number<uint16_t>;
+
+    const serial value {65535};
+    EXPECT_EQ(1, (value + 2).value());
+    EXPECT_TRUE(ndgpp::in_window(serial {1}, value, 4));
+    EXPECT_FALSE(ndgpp::in_window(serial {3}, value, 4));
+}
+
+TEST(serial_number, network_byte_order_storage)
+{
+    using serial = ndgpp::serial_number<uint32_t, ndgpp::network_endian>;
+
+    serial value {0x01020304};
+    std::array<uint8_t, 4> buf;
+    std::memcpy(buf.data(), &value, sizeof(value));
+    EXPECT_EQ((std::array<uint8_t, 4> {0x01, 0x02, 0x03, 0x04}), buf);
+
+    value += 0xfffffffd;
+    EXPECT_EQ(0x01020301U, value.value());
+    EXPECT_LT(value, serial {0x01020304});
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <libndgpp/bounded_integer.hpp>
+#include <libndgpp/net/ipv4_address.hpp>
+#include <libndgpp/net/port.hpp>
+#include <libndgpp/network_byte_order.hpp>
+#include <libndgpp/sortable_key.hpp>
+
+namespace
+{
+    template <class T>
+    class sortable_key_integral: public ::testing::Test
+    {};
+
+    using integral_types = ::testing::Types<uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t>;
+    TYPED_TEST_CASE(sortable_key_integral, integral_types);
+
+    template <class T>
+    bool memcmp_less(const T & lhs, const T & rhs)
+    {
+        return std::memcmp(lhs.data(), rhs.data(), lhs.size()) < 0;
+    }
+}
+
+TYPED_TEST(sortable_key_integral, order)
+{
+    using limits = std::numeric_limits<TypeParam>;
+    const std::vector<TypeParam> values {limits::min(),
+                                         static_cast<TypeParam>(limits::min() + 1),
+                                         static_cast<TypeParam>(limits::is_signed ? -1 : 1),
+                                         0,
+                                         1,
+                                         static_cast<TypeParam>(limits::max() - 1),
+                                         limits::max()};
+
+    for (const TypeParam lhs: values)
+    {
+        for (const TypeParam rhs: values)
+        {
+            EXPECT_EQ(lhs < rhs, memcmp_less(ndgpp::make_sortable_key(lhs), ndgpp::make_sortable_key(rhs)));
+        }
+
+        const auto key = ndgpp::make_sortable_key(lhs);
+        EXPECT_EQ(lhs, std::get<0>(ndgpp::decode_sortable_key<TypeParam>(key.data())));
+    }
+}
+
+TEST(sortable_key, signed_encoding)
+{
+    using key_type = ndgpp::sortable_key<int16_t>;
+    EXPECT_EQ((key_type {{0x00, 0x00}}), ndgpp::make_sortable_key(int16_t {-32768}));
+    EXPECT_EQ((key_type {{0x7f, 0xff}}), ndgpp::make_sortable_key(int16_t {-1}));
+    EXPECT_EQ((key_type {{0x80, 0x00}}), ndgpp::make_sortable_key(int16_t {0}));
+    EXPECT_EQ((key_type {{0xff, 0xff}}), ndgpp::make_sortable_key(int16_t {32767}));
+}
+
+TEST(sortable_key, size)
+{
+    EXPECT_EQ(6U, (ndgpp::sortable_key_size<ndgpp::net::ipv4_address, ndgpp::net::port>::value));
+    EXPECT_EQ(13U, (ndgpp::sortable_key_size<ndgpp::net::ipv4_address,
+                                             ndgpp::net::ipv4_address,
+                                             ndgpp::net::port,
+                                             ndgpp::net::port,
+                                             uint8_t>::value));
+}
+
+TEST(sortable_key, composite_order)
+{
+    using bounded = ndgpp::bounded_integer<int32_t, -1000, 1000>;
+    using key_tuple = std::tuple<ndgpp::net::ipv4_address,
+                                 ndgpp::net::port,
+                                 bounded,
+                                 ndgpp::network_byte_order<uint32_t>>;
+
+    std::mt19937 gen {1};
+    std::uniform_int_distribution<uint32_t> small {0, 3};
+    std::uniform_int_distribution<int32_t> bounded_dist {-1000, 1000};
+
+    std::vector<key_tuple> tuples;
+    for (int i = 0; i < 500; ++i)
+    {
+        // Few distinct leading components so later components decide the order
+        tuples.emplace_back(ndgpp::net::ipv4_address {small(gen) << 24 | small(gen)},
+                            ndgpp::net::port {static_cast<uint16_t>(small(gen) * 0x4001)},
+                            bounded {bounded_dist(gen)},
+                            ndgpp::network_byte_order<uint32_t> {static_cast<uint32_t>(gen())});
+    }
+
+    using key_type = ndgpp::sortable_key<key_tuple>;
+    std::vector<key_type> keys;
+    for (const auto & t: tuples)
+    {
+        keys.push_back(ndgpp::make_sortable_key(t));
+    }
+
+    std::sort(tuples.begin(), tuples.end());
+    std::sort(keys.begin(), keys.end(), memcmp_less<key_type>);
+
+    for (std::size_t i = 0; i < tuples.size(); ++i)
+    {
+        const auto decoded = ndgpp::decode_sortable_key<ndgpp::net::ipv4_address,
+                                                        ndgpp::net::port,
+                                                        bounded,
+                                                        ndgpp::network_byte_order<uint32_t>>(keys[i].data());
+        EXPECT_EQ(tuples[i], decoded);
+    }
+}
+
+TEST(sortable_key, encode_in_place)
+{
+    const ndgpp::net::ipv4_address addr {std::array<uint8_t, 4> {{10, 1, 2, 3}}};
+    const ndgpp::net::port port {443};
+
+    uint8_t key[ndgpp::sortable_key_size<ndgpp::net::ipv4_address, ndgpp::net::port>::value];
+    ndgpp::encode_sortable_key(key, addr, port);
+
+    const uint8_t expected[] = {10, 1, 2, 3, 0x01, 0xbb};
+    EXPECT_EQ(0, std::memcmp(expected, key, sizeof(key)));
+}
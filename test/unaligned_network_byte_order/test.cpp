@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <sstream>
+
+#include <libndgpp/unaligned_network_byte_order.hpp>
+
+using host_types = ::testing::Types<uint16_t, uint32_t, uint64_t>;
+
+template <class T>
+struct values;
+
+template <>
+struct values<uint16_t>
+{
+    static constexpr uint16_t scalar = 0xabcd;
+    static constexpr std::array<uint8_t, 2> array = {0xab, 0xcd};
+};
+
+constexpr uint16_t values<uint16_t>::scalar;
+constexpr std::array<uint8_t, 2> values<uint16_t>::array;
+
+template <>
+struct values<uint32_t>
+{
+    static constexpr uint32_t scalar = 0xabcdefbc;
+    static constexpr std::array<uint8_t, 4> array = {0xab, 0xcd, 0xef, 0xbc};
+};
+
+constexpr uint32_t values<uint32_t>::scalar;
+constexpr std::array<uint8_t, 4> values<uint32_t>::array;
+
+template <>
+struct values<uint64_t>
+{
+    static constexpr uint64_t scalar = 0xabcdefbcabcdefbc;
+    static constexpr std::array<uint8_t, 8> array = {0xab, 0xcd, 0xef, 0xbc, 0xab, 0xcd, 0xef, 0xbc};
+};
+
+constexpr uint64_t values<uint64_t>::scalar;
+constexpr std::array<uint8_t, 8> values<uint64_t>::array;
+
+template <class T>
+class member_test: public ::testing::Test
+{
+    public:
+
+    using value_type = T;
+    using array_type = std::array<uint8_t, sizeof(T)>;
+};
+
+TYPED_TEST_CASE(member_test, host_types);
+
+TYPED_TEST(member_test, layout)
+{
+    using value_type = typename TestFixture::value_type;
+    EXPECT_EQ(1U, alignof(ndgpp::unaligned_network_byte_order<value_type>));
+    EXPECT_EQ(sizeof(value_type), sizeof(ndgpp::unaligned_network_byte_order<value_type>));
+}
+
+TYPED_TEST(member_test, value_type_ctor)
+{
+    using value_type = typename TestFixture::value_type;
+    const ndgpp::unaligned_network_byte_order<value_type> nbo(values<value_type>::scalar);
+
+    EXPECT_EQ(values<value_type>::scalar, static_cast<value_type>(nbo));
+
+    typename TestFixture::array_type buf;
+    std::memcpy(buf.data(), &nbo, nbo.size());
+    EXPECT_EQ(values<value_type>::array, buf);
+}
+
+TYPED_TEST(member_test, value_type_assignment)
+{
+    using value_type = typename TestFixture::value_type;
+
+    ndgpp::unaligned_network_byte_order<value_type> nbo;
+    ndgpp::unaligned_network_byte_order<value_type> & nbo2 = nbo = values<value_type>::scalar;
+
+    EXPECT_EQ(values<value_type>::scalar, static_cast<value_type>(nbo));
+    EXPECT_EQ(std::addressof(nbo), std::addressof(nbo2));
+
+    typename TestFixture::array_type buf;
+    std::memcpy(buf.data(), &nbo, nbo.size());
+    EXPECT_EQ(values<value_type>::array, buf);
+}
+
+TYPED_TEST(member_test, network_byte_order_conversion)
+{
+    using value_type = typename TestFixture::value_type;
+
+    const ndgpp::network_byte_order<value_type> aligned(values<value_type>::scalar);
+    const ndgpp::unaligned_network_byte_order<value_type> nbo(aligned);
+
+    EXPECT_EQ(values<value_type>::scalar, static_cast<value_type>(nbo));
+    EXPECT_EQ(aligned, nbo.network_value());
+}
+
+TYPED_TEST(member_test, overlay)
+{
+    using value_type = typename TestFixture::value_type;
+    using nbo_type = ndgpp::unaligned_network_byte_order<value_type>;
+
+    std::array<uint8_t, sizeof(value_type) + 1> buf {};
+    std::copy(values<value_type>::array.begin(), values<value_type>::array.end(), buf.begin() + 1);
+
+    nbo_type * nbo = reinterpret_cast<nbo_type *>(buf.data() + 1);
+    EXPECT_EQ(values<value_type>::scalar, static_cast<value_type>(*nbo));
+
+    *nbo = static_cast<value_type>(values<value_type>::scalar + 1);
+    EXPECT_EQ(static_cast<value_type>(values<value_type>::scalar + 1), static_cast<value_type>(*nbo));
+    EXPECT_EQ(0U, buf[0]);
+}
+
+template <class T>
+class operator_test: public ::testing::Test
+{
+    public:
+
+    using value_type = T;
+
+    operator_test():
+        nb1{values<T>::scalar},
+        nb2{static_cast<T>(values<T>::scalar + 1)},
+        nb3{static_cast<T>(values<T>::scalar + 0x100)}
+    {}
+
+    ndgpp::unaligned_network_byte_order<T> nb1;
+    ndgpp::unaligned_network_byte_order<T> nb2;
+    ndgpp::unaligned_network_byte_order<T> nb3;
+};
+
+TYPED_TEST_CASE(operator_test, host_types);
+
+TYPED_TEST(operator_test, equality)
+{
+    EXPECT_EQ(this->nb1, this->nb1);
+    EXPECT_FALSE(this->nb1 == this->nb2);
+    EXPECT_TRUE(this->nb1 != this->nb2);
+    EXPECT_FALSE(this->nb1 != this->nb1);
+}
+
+TYPED_TEST(operator_test, ordering)
+{
+    EXPECT_LT(this->nb1, this->nb2);
+    EXPECT_LT(this->nb2, this->nb3);
+    EXPECT_GT(this->nb3, this->nb2);
+    EXPECT_LE(this->nb1, this->nb1);
+    EXPECT_GE(this->nb3, this->nb1);
+    EXPECT_FALSE(this->nb3 < this->nb2);
+}
+
+TYPED_TEST(operator_test, swap)
+{
+    using value_type = typename TestFixture::value_type;
+
+    swap(this->nb1, this->nb2);
+    EXPECT_EQ(static_cast<value_type>(values<value_type>::scalar + 1), static_cast<value_type>(this->nb1));
+    EXPECT_EQ(values<value_type>::scalar, static_cast<value_type>(this->nb2));
+}
+
+TYPED_TEST(operator_test, insertion)
+{
+    std::stringstream ss;
+    ss << this->nb1;
+
+    std::stringstream expected;
+    expected << values<typename TestFixture::value_type>::scalar;
+    EXPECT_EQ(expected.str(), ss.str());
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <libndgpp/varint.hpp>
+
+TEST(zigzag, encode)
+{
+    EXPECT_EQ(0U, ndgpp::zigzag_encode(int32_t {0}));
+    EXPECT_EQ(1U, ndgpp::zigzag_encode(int32_t {-1}));
+    EXPECT_EQ(2U, ndgpp::zigzag_encode(int32_t {1}));
+    EXPECT_EQ(3U, ndgpp::zigzag_encode(int32_t {-2}));
+    EXPECT_EQ(0xfffffffeU, ndgpp::zigzag_encode(std::numeric_limits<int32_t>::max()));
+    EXPECT_EQ(0xffffffffU, ndgpp::zigzag_encode(std::numeric_limits<int32_t>::min()));
+    EXPECT_EQ(0xff, ndgpp::zigzag_encode(std::numeric_limits<int8_t>::min()));
+}
+
+TEST(zigzag, decode)
+{
+    EXPECT_EQ(0, ndgpp::zigzag_decode(uint32_t {0}));
+    EXPECT_EQ(-1, ndgpp::zigzag_decode(uint32_t {1}));
+    EXPECT_EQ(1, ndgpp::zigzag_decode(uint32_t {2}));
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), ndgpp::zigzag_decode(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(varint, size)
+{
+    EXPECT_EQ(1U, ndgpp::varint_size(uint32_t {0}));
+    EXPECT_EQ(1U, ndgpp::varint_size(uint32_t {127}));
+    EXPECT_EQ(2U, ndgpp::varint_size(uint32_t {128}));
+    EXPECT_EQ(2U, ndgpp::varint_size(uint32_t {16383}));
+    EXPECT_EQ(3U, ndgpp::varint_size(uint32_t {16384}));
+    EXPECT_EQ(5U, ndgpp::varint_size(std::numeric_limits<uint32_t>::max()));
+    EXPECT_EQ(10U, ndgpp::varint_size(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(1U, ndgpp::varint_size(int32_t {-64}));
+    EXPECT_EQ(2U, ndgpp::varint_size(int32_t {-65}));
+}
+
+TEST(varint, encode)
+{
+    std::array<uint8_t, 10> buf {};
+    uint8_t * const end = ndgpp::varint_encode(uint32_t {300}, buf.data());
+    ASSERT_EQ(2, end - buf.data());
+    EXPECT_EQ(0xac, buf[0]);
+    EXPECT_EQ(0x02, buf[1]);
+}
+
+TEST(varint, decode)
+{
+    const std::array<uint8_t, 3> buf = {0xac, 0x02, 0xff};
+    const ndgpp::varint_result<uint16_t> result = ndgpp::varint_decode<uint16_t>(buf.data(), buf.data() + buf.size());
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(300, result.value());
+    EXPECT_EQ(buf.data() + 2, result.unparsed());
+}
+
+TEST(varint, truncated)
+{
+    const std::array<uint8_t, 2> buf = {0xac, 0x82};
+    const auto result = ndgpp::varint_decode<uint32_t>(buf.data(), buf.data() + buf.size());
+    EXPECT_FALSE(static_cast<bool>(result));
+    EXPECT_TRUE(result.truncated());
+    EXPECT_EQ(buf.data(), result.unparsed());
+    EXPECT_THROW(result.value(), ndgpp::error<std::logic_error>);
+}
+
+TEST(varint, overlong)
+{
+    {
+        // 2^32 does not fit in a uint32_t
+        const std::array<uint8_t, 12> buf = {0x80, 0x80, 0x80, 0x80, 0x10, 0, 0, 0, 0, 0, 0, 0};
+        const auto result = ndgpp::varint_decode<uint32_t>(buf.data(), buf.data() + 5);
+        EXPECT_TRUE(result.overlong());
+
+        const auto padded_result = ndgpp::varint_decode<uint32_t>(buf.data(), buf.data() + buf.size());
+        EXPECT_TRUE(padded_result.overlong());
+    }
+
+    {
+        // Six bytes are too many for a uint32_t
+        const std::array<uint8_t, 12> buf = {0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0, 0, 0, 0, 0, 0};
+        EXPECT_TRUE(ndgpp::varint_decode<uint32_t>(buf.data(), buf.data() + 6).overlong());
+        EXPECT_TRUE(ndgpp::varint_decode<uint32_t>(buf.data(), buf.data() + buf.size()).overlong());
+    }
+
+    {
+        const std::array<uint8_t, 2> buf = {0x80, 0x02};
+        EXPECT_TRUE(ndgpp::varint_decode<uint8_t>(buf.data(), buf.data() + buf.size()).overlong());
+    }
+}
+
+template <class T>
+class round_trip_test: public ::testing::Test
+{};
+
+using integer_types = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t>;
+TYPED_TEST_CASE(round_trip_test, integer_types);
+
+TYPED_TEST(round_trip_test, limits)
+{
+    using limits = std::numeric_limits<TypeParam>;
+    const std::vector<TypeParam> values = {limits::min(),
+                                           static_cast<TypeParam>(limits::min() + 1),
+                                           TypeParam {0},
+                                           TypeParam {1},
+                                           TypeParam {127},
+                                           static_cast<TypeParam>(limits::max() / 3),
+                                           static_cast<TypeParam>(limits::max() - 1),
+                                           limits::max()};
+
+    // Padding ensures the multi-byte decode path is used when available
+    std::vector<uint8_t> buf(values.size() * ndgpp::varint_max_size<TypeParam>::value + 8);
+
+    std::size_t expected_size = 0;
+    for (const auto value: values)
+    {
+        expected_size += ndgpp::varint_size(value);
+    }
+
+    uint8_t * const end = ndgpp::varint_encode(values.data(), values.data() + values.size(), buf.data());
+    ASSERT_EQ(expected_size, static_cast<std::size_t>(end - buf.data()));
+
+    std::vector<TypeParam> decoded(values.size());
+    const auto result = ndgpp::varint_decode(buf.data(), static_cast<uint8_t const *>(end), decoded.data(), decoded.size());
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(values.size(), result.value());
+    EXPECT_EQ(end, result.unparsed());
+    EXPECT_EQ(values, decoded);
+}
+
+TEST(varint, bulk_decode_error)
+{
+    const std::array<uint8_t, 4> buf = {0x01, 0x02, 0x80, 0x80};
+    std::array<uint32_t, 4> values {};
+    const auto result = ndgpp::varint_decode(buf.data(), buf.data() + buf.size(), values.data(), values.size());
+    EXPECT_TRUE(result.truncated());
+    EXPECT_EQ(buf.data() + 2, result.unparsed());
+    EXPECT_EQ(1U, values[0]);
+    EXPECT_EQ(2U, values[1]);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <libndgpp/wire_layout.hpp>
+
+namespace
+{
+    struct length;
+    struct type;
+    struct mac;
+    struct sequence;
+
+    using header = ndgpp::wire_layout<ndgpp::wire_field<length, ndgpp::network_byte_order<uint16_t>>,
+                                      ndgpp::wire_field<type, uint8_t>,
+                                      ndgpp::wire_field<mac, std::array<uint8_t, 6>>,
+                                      ndgpp::wire_field<sequence, ndgpp::network_byte_order<uint32_t>>>;
+}
+
+TEST(wire_layout, size)
+{
+    constexpr std::size_t size = header::size;
+    EXPECT_EQ(13U, size);
+}
+
+TEST(wire_layout, offset)
+{
+    constexpr std::size_t length_offset = header::offset<length>();
+    constexpr std::size_t type_offset = header::offset<type>();
+    constexpr std::size_t mac_offset = header::offset<mac>();
+    constexpr std::size_t sequence_offset = header::offset<sequence>();
+
+    EXPECT_EQ(0U, length_offset);
+    EXPECT_EQ(2U, type_offset);
+    EXPECT_EQ(3U, mac_offset);
+    EXPECT_EQ(9U, sequence_offset);
+}
+
+TEST(wire_layout, field_type)
+{
+    constexpr bool length_type = std::is_same<header::field_type<length>,
+                                              ndgpp::unaligned_network_byte_order<uint16_t>>::value;
+    constexpr bool mac_type = std::is_same<header::field_type<mac>, std::array<uint8_t, 6>>::value;
+
+    EXPECT_TRUE(length_type);
+    EXPECT_TRUE(mac_type);
+}
+
+TEST(wire_view, read)
+{
+    const std::array<uint8_t, header::size + 1> buf = {0xff,
+                                                       0x01, 0x02,
+                                                       0x03,
+                                                       0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+                                                       0xde, 0xad, 0xbe, 0xef};
+
+    const ndgpp::wire_view<header, const uint8_t> view {buf.data() + 1};
+
+    EXPECT_EQ(0x0102, view.get<length>());
+    EXPECT_EQ(0x03, view.get<type>());
+    EXPECT_EQ((std::array<uint8_t, 6> {0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f}), view.get<mac>());
+    EXPECT_EQ(0xdeadbeef, view.get<sequence>());
+}
+
+TEST(wire_view, write)
+{
+    std::array<uint8_t, header::size> buf {};
+    const ndgpp::wire_view<header> view {buf.data()};
+
+    view.get<length>() = 0x0102;
+    view.get<type>() = 0x03;
+    view.get<mac>() = {0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+    view.get<sequence>() = 0xdeadbeef;
+
+    const std::array<uint8_t, header::size> expected = {0x01, 0x02,
+                                                        0x03,
+                                                        0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+                                                        0xde, 0xad, 0xbe, 0xef};
+    EXPECT_EQ(expected, buf);
+}